@@ -1,25 +1,55 @@
 #pragma once
+#include <atomic>
+#include <condition_variable>
+#include <deque>
 #include <future>
+#include <memory>
 #include <mutex>
+#include <optional>
+#include <thread>
+#include <unordered_map>
+#include <variant>
+#include <vector>
 //
+#include <span>
 #include <string>
 #include <string_view>
 //
 #include <iostream>
+//
+#if defined(__linux__)
+#include <fcntl.h>
+#include <linux/io_uring.h>
+#include <poll.h>
+#include <sys/eventfd.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+//
+#include <cerrno>
+#endif
+//
+#include <lyrahgames/xstd/coroutine.hpp>
+#include <lyrahgames/xstd/utility.hpp>
 
 namespace lyrahgames::xstd {
 
-struct async_cio_state : std::future<std::string> {
-  async_cio_state() = default;
-  async_cio_state(std::future<std::string>&& f)
-      : std::future<std::string>{std::move(f)} {}
+/// A future whose result can be polled without blocking.
+/// It is used as the return type of all asynchronous operations.
+///
+template <typename T>
+struct async_state : std::future<T> {
+  async_state() = default;
+  async_state(std::future<T>&& f) : std::future<T>{std::move(f)} {}
 
   bool available() const {
     using namespace std::chrono_literals;
-    return std::future_status::ready == wait_for(0s);
+    return std::future_status::ready == this->wait_for(0s);
   }
 };
 
+using async_cio_state = async_state<std::string>;
+
 inline std::mutex async_cio_mutex{};
 
 inline auto async_line_read(std::string_view prompt = "\n>>> ")
@@ -35,4 +65,673 @@ inline auto async_line_read(std::string_view prompt = "\n>>> ")
   });
 }
 
+// The following readers are built on Linux system calls,
+// such as 'eventfd' and io_uring.
+//
+#if defined(__linux__)
+
+/// The 'async_line_reader' reads lines from a file descriptor,
+/// typically the standard input, by a single background thread.
+/// Instead of creating a new thread for every line,
+/// completed lines are pushed into a queue
+/// which can be polled or waited on by the caller.
+/// The background thread waits on the file descriptor by using 'poll'
+/// together with an 'eventfd' such that it can be cancelled at any time.
+/// The file descriptor is read directly.
+/// So, do not mix its usage with 'std::cin'.
+/// Inside coroutines, lines can be awaited by 'async_get'.
+///
+struct async_line_reader {
+  explicit async_line_reader(int fd = STDIN_FILENO)
+      : input{fd}, cancel{::eventfd(0, EFD_CLOEXEC)} {
+    if (cancel == -1)
+      throw std::runtime_error("Failed to create event for line reader.");
+    worker = std::thread{[this] { run(); }};
+  }
+
+  // The background thread refers to the reader.
+  // So, it can neither be copied nor moved.
+  //
+  async_line_reader(const async_line_reader&) = delete;
+  async_line_reader& operator=(const async_line_reader&) = delete;
+
+  ~async_line_reader() noexcept {
+    stop();
+    ::close(cancel);
+  }
+
+  /// Checks whether a line can be taken without blocking.
+  ///
+  bool available() const {
+    std::scoped_lock lock{mutex};
+    return !lines.empty();
+  }
+
+  /// Checks whether no more lines will be provided.
+  /// This is the case when the end of the input has been reached
+  /// or the reader has been stopped and all lines have been taken.
+  ///
+  bool done() const {
+    std::scoped_lock lock{mutex};
+    return finished && lines.empty();
+  }
+
+  /// Take the next line if it is available without blocking.
+  ///
+  auto try_get() -> std::optional<std::string> {
+    std::scoped_lock lock{mutex};
+    return pop();
+  }
+
+  /// Block until the next line is available.
+  /// If no more lines will be provided, nothing is returned.
+  ///
+  auto get() -> std::optional<std::string> {
+    std::unique_lock lock{mutex};
+    ready.wait(lock, [this] { return finished || !lines.empty(); });
+    return pop();
+  }
+
+  /// Block until the next line is available or the given time has passed.
+  ///
+  template <typename rep, typename period>
+  auto get_for(const std::chrono::duration<rep, period>& time)
+      -> std::optional<std::string> {
+    std::unique_lock lock{mutex};
+    ready.wait_for(lock, time, [this] { return finished || !lines.empty(); });
+    return pop();
+  }
+
+  /// Cancel the background thread and wait for its shutdown.
+  /// Lines that have already been read stay available.
+  ///
+  void stop() noexcept {
+    if (!worker.joinable()) return;
+    const uint64_t signal = 1;
+    [[maybe_unused]] const auto _ = ::write(cancel, &signal, sizeof(signal));
+    worker.join();
+  }
+
+  auto pop() -> std::optional<std::string> {
+    if (lines.empty()) return std::nullopt;
+    auto line = std::move(lines.front());
+    lines.pop_front();
+    return line;
+  }
+
+  void run() {
+    pollfd fds[] = {{input, POLLIN, 0}, {cancel, POLLIN, 0}};
+    char buffer[4096];
+    std::string partial{};
+    std::deque<std::string> completed{};
+    while (true) {
+      if (::poll(fds, 2, -1) == -1) {
+        if (errno == EINTR) continue;
+        break;
+      }
+      if (fds[1].revents) break;
+      if (!fds[0].revents) continue;
+      const auto count = ::read(input, buffer, sizeof(buffer));
+      if (count == -1) {
+        if (errno == EINTR || errno == EAGAIN) continue;
+        break;
+      }
+      if (count == 0) {
+        // The last line does not need to end with a newline character.
+        if (!partial.empty()) completed.push_back(std::move(partial));
+        break;
+      }
+      // Split the newly read characters into lines
+      // and publish all completed lines at once.
+      for (std::string_view rest{buffer, size_t(count)}; !rest.empty();) {
+        const auto p = rest.find('\n');
+        partial += rest.substr(0, p);
+        if (p == rest.npos) break;
+        completed.push_back(std::move(partial));
+        partial.clear();
+        rest.remove_prefix(p + 1);
+      }
+      if (!completed.empty()) publish(completed, false);
+    }
+    publish(completed, true);
+  }
+
+  // Hand over completed lines to waiting coroutines first
+  // and queue the remaining ones.
+  // The coroutines are resumed by their executors
+  // after the lock has been released.
+  //
+  void publish(std::deque<std::string>& completed, bool finish) {
+    std::vector<waiter> resumed{};
+    {
+      std::scoped_lock lock{mutex};
+      for (auto& line : completed) {
+        if (waiters.empty()) {
+          lines.push_back(std::move(line));
+          continue;
+        }
+        *waiters.front().line = std::move(line);
+        resumed.push_back(waiters.front());
+        waiters.pop_front();
+      }
+      if (finish) {
+        finished = true;
+        resumed.insert(resumed.end(), waiters.begin(), waiters.end());
+        waiters.clear();
+      }
+    }
+    completed.clear();
+    ready.notify_all();
+    for (auto& w : resumed)
+      w.executor->post(w.handle);
+  }
+
+  // Suspended coroutines waiting for a line are stored together
+  // with their executor and the location of the line to be received.
+  //
+  struct waiter {
+    std::optional<std::string>* line;
+    task_executor* executor;
+    std::coroutine_handle<> handle;
+  };
+
+  /// Asynchronously wait for the next line inside a coroutine.
+  /// The coroutine is suspended until a line has been read
+  /// and is then resumed by the given executor.
+  /// If no more lines will be provided, nothing is returned.
+  ///
+  /// while (auto line = co_await reader.async_get(executor)) ...
+  ///
+  auto async_get(task_executor& executor) {
+    struct awaiter {
+      bool await_ready() noexcept { return false; }
+      bool await_suspend(std::coroutine_handle<> h) {
+        std::scoped_lock lock{reader.mutex};
+        line = reader.pop();
+        if (line || reader.finished) return false;
+        reader.waiters.push_back({&line, &executor, h});
+        return true;
+      }
+      auto await_resume() noexcept { return std::move(line); }
+
+      async_line_reader& reader;
+      task_executor& executor;
+      std::optional<std::string> line{};
+    };
+    return awaiter{*this, executor};
+  }
+
+  int input;
+  int cancel;
+  mutable std::mutex mutex{};
+  std::condition_variable ready{};
+  std::deque<std::string> lines{};
+  std::deque<waiter> waiters{};
+  bool finished = false;
+  std::thread worker{};
+};
+
+namespace detail {
+
+// Every asynchronous read or write is described by a request
+// which stays alive until the operation has been completed.
+//
+struct async_io_request {
+  enum class operation { read, write };
+
+  operation op;
+  int fd;
+  char* data;
+  size_t size;
+  uint64 offset;
+  std::promise<size_t> result{};
+
+  void complete(ssize_t count) {
+    if (count >= 0) return result.set_value(count);
+    result.set_exception(std::make_exception_ptr(std::runtime_error(
+        (op == operation::read) ? "Failed to read from the file."
+                                : "Failed to write to the file.")));
+  }
+};
+
+// Submission and completion of requests through Linux io_uring.
+// The system calls are used directly to not depend on liburing.
+// Requests are submitted by the calling thread
+// and completions are reaped by a single background thread
+// which sleeps inside the kernel until completions arrive.
+//
+struct io_uring_queue {
+  explicit io_uring_queue(unsigned entries) {
+    io_uring_params params{};
+    ring = ::syscall(__NR_io_uring_setup, entries, &params);
+    if (ring < 0) throw std::runtime_error("Failed to set up io_uring.");
+    // Reading and writing at the current file position
+    // is supported since the same kernel version
+    // that introduced the needed read and write operations.
+    if (!(params.features & IORING_FEAT_RW_CUR_POS)) {
+      ::close(ring);
+      throw std::runtime_error("Failed to set up io_uring.");
+    }
+
+    sq_size = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+    cq_size = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+    if (params.features & IORING_FEAT_SINGLE_MMAP)
+      sq_size = cq_size = std::max(sq_size, cq_size);
+    sqes_size = params.sq_entries * sizeof(io_uring_sqe);
+
+    try {
+      sq_ptr = map(sq_size, IORING_OFF_SQ_RING);
+      cq_ptr = (params.features & IORING_FEAT_SINGLE_MMAP)
+                   ? sq_ptr
+                   : map(cq_size, IORING_OFF_CQ_RING);
+      sqes = static_cast<io_uring_sqe*>(map(sqes_size, IORING_OFF_SQES));
+    } catch (...) {
+      release();
+      throw;
+    }
+
+    const auto sq = static_cast<char*>(sq_ptr);
+    sq_head = reinterpret_cast<unsigned*>(sq + params.sq_off.head);
+    sq_tail = reinterpret_cast<unsigned*>(sq + params.sq_off.tail);
+    sq_mask = *reinterpret_cast<unsigned*>(sq + params.sq_off.ring_mask);
+    sq_array = reinterpret_cast<unsigned*>(sq + params.sq_off.array);
+    sq_entries = params.sq_entries;
+
+    const auto cq = static_cast<char*>(cq_ptr);
+    cq_head = reinterpret_cast<unsigned*>(cq + params.cq_off.head);
+    cq_tail = reinterpret_cast<unsigned*>(cq + params.cq_off.tail);
+    cq_mask = *reinterpret_cast<unsigned*>(cq + params.cq_off.ring_mask);
+    cqes = reinterpret_cast<io_uring_cqe*>(cq + params.cq_off.cqes);
+
+    worker = std::thread{[this] { run(); }};
+  }
+
+  io_uring_queue(const io_uring_queue&) = delete;
+  io_uring_queue& operator=(const io_uring_queue&) = delete;
+
+  ~io_uring_queue() noexcept {
+    // A no-op request without user data tells the worker to shut down.
+    if (worker.joinable()) {
+      while (true) {
+        {
+          std::scoped_lock lock{mutex};
+          if (push(IORING_OP_NOP, -1, nullptr, 0, 0, 0)) break;
+        }
+        if (!enter()) std::this_thread::yield();
+      }
+      enter();
+      worker.join();
+    }
+    release();
+  }
+
+  void release() noexcept {
+    if (sqes) ::munmap(sqes, sqes_size);
+    if (cq_ptr && cq_ptr != sq_ptr) ::munmap(cq_ptr, cq_size);
+    if (sq_ptr) ::munmap(sq_ptr, sq_size);
+    ::close(ring);
+  }
+
+  auto map(size_t size, off_t offset) -> void* {
+    const auto ptr = ::mmap(nullptr, size, PROT_READ | PROT_WRITE,
+                            MAP_SHARED | MAP_POPULATE, ring, offset);
+    if (ptr == MAP_FAILED) throw std::runtime_error("Failed to map io_uring.");
+    return ptr;
+  }
+
+  // Put a new entry into the submission queue.
+  // If the queue is full, nothing is published and false is returned.
+  // The mutex needs to be locked.
+  //
+  bool push(uint8 opcode,
+            int fd,
+            void* data,
+            size_t size,
+            uint64 offset,
+            uint64 user_data) {
+    const auto tail = *sq_tail;
+    const auto head = std::atomic_ref{*sq_head}.load(std::memory_order_acquire);
+    if (tail - head == sq_entries) return false;
+    const auto index = tail & sq_mask;
+    auto& sqe = sqes[index];
+    sqe = io_uring_sqe{};
+    sqe.opcode = opcode;
+    sqe.fd = fd;
+    sqe.addr = reinterpret_cast<uint64>(data);
+    sqe.len = size;
+    sqe.off = offset;
+    sqe.user_data = user_data;
+    sq_array[index] = index;
+    std::atomic_ref{*sq_tail}.store(tail + 1, std::memory_order_release);
+    return true;
+  }
+
+  // Submit all published entries to the kernel.
+  // The mutex must not be locked.
+  // Otherwise, the worker could not reap completions
+  // when a full completion queue makes the kernel answer with EBUSY.
+  // Entries that could not be submitted stay in the submission queue
+  // and are taken by the kernel with the next call.
+  // False is only returned if the kernel reports an actual error.
+  //
+  bool enter() noexcept {
+    while (::syscall(__NR_io_uring_enter, ring, sq_entries, 0, 0, nullptr, 0) <
+           0) {
+      if (errno == EINTR) continue;
+      if (errno != EAGAIN && errno != EBUSY) return false;
+      std::this_thread::yield();
+    }
+    return true;
+  }
+
+  void submit(std::unique_ptr<async_io_request> request) {
+    using operation = async_io_request::operation;
+    const auto opcode =
+        (request->op == operation::read) ? IORING_OP_READ : IORING_OP_WRITE;
+    // Transfers are limited to 32-bit sizes.
+    const auto size = std::min<size_t>(request->size, size_t{1} << 30);
+    const auto r = request.get();
+    // If the submission queue is full, its entries are handed to the kernel
+    // to make room for the new one.
+    // The request has to be pending before its entry is published.
+    // Only unpublished requests may be failed and released.
+    while (true) {
+      {
+        std::scoped_lock lock{mutex};
+        if (push(opcode, r->fd, r->data, size, r->offset, uint64(r))) {
+          pending.emplace(r, std::move(request));
+          break;
+        }
+      }
+      if (!enter()) return request->complete(-1);
+    }
+    enter();
+  }
+
+  void run() {
+    while (true) {
+      auto head = *cq_head;
+      const auto tail =
+          std::atomic_ref{*cq_tail}.load(std::memory_order_acquire);
+      if (head == tail) {
+        ::syscall(__NR_io_uring_enter, ring, 0, 1, IORING_ENTER_GETEVENTS,
+                  nullptr, 0);
+        continue;
+      }
+      bool shutdown = false;
+      for (; head != tail; ++head) {
+        const auto& cqe = cqes[head & cq_mask];
+        if (!cqe.user_data) {
+          shutdown = true;
+          continue;
+        }
+        // Taking the request out of the pending list
+        // synchronizes with its submission.
+        const auto r = reinterpret_cast<async_io_request*>(cqe.user_data);
+        std::unique_ptr<async_io_request> request{};
+        {
+          std::scoped_lock lock{mutex};
+          auto node = pending.extract(r);
+          if (node) request = std::move(node.mapped());
+        }
+        if (request) request->complete(cqe.res);
+      }
+      std::atomic_ref{*cq_head}.store(tail, std::memory_order_release);
+      if (shutdown) return;
+    }
+  }
+
+  int ring = -1;
+  size_t sq_size = 0;
+  size_t cq_size = 0;
+  size_t sqes_size = 0;
+  void* sq_ptr = nullptr;
+  void* cq_ptr = nullptr;
+  io_uring_sqe* sqes = nullptr;
+  unsigned* sq_head;
+  unsigned* sq_tail;
+  unsigned* sq_array;
+  unsigned sq_mask;
+  unsigned sq_entries;
+  unsigned* cq_head;
+  unsigned* cq_tail;
+  unsigned cq_mask;
+  io_uring_cqe* cqes;
+
+  std::mutex mutex{};
+  std::unordered_map<async_io_request*, std::unique_ptr<async_io_request>>
+      pending{};
+  std::thread worker{};
+};
+
+// The fallback for systems without io_uring.
+// A single background thread waits for the readiness
+// of all pending file descriptors with 'poll'
+// and executes the ready operations.
+// New requests wake the thread through an 'eventfd'.
+//
+// Several requests may wait for the same file descriptor.
+// All of them are reported to be ready
+// but the first one may already take all available data.
+// A blocking call would then stall the thread and all other requests.
+// So, file descriptors are put into non-blocking mode
+// while requests for them are pending
+// and operations that would block are kept in the poll set.
+// Afterwards, their original flags are restored.
+//
+struct poll_io_queue {
+  poll_io_queue() : wake{::eventfd(0, EFD_CLOEXEC)} {
+    if (wake == -1)
+      throw std::runtime_error("Failed to create event for I/O queue.");
+    worker = std::thread{[this] { run(); }};
+  }
+
+  poll_io_queue(const poll_io_queue&) = delete;
+  poll_io_queue& operator=(const poll_io_queue&) = delete;
+
+  ~poll_io_queue() noexcept {
+    {
+      std::scoped_lock lock{mutex};
+      shutdown = true;
+    }
+    signal();
+    worker.join();
+    ::close(wake);
+  }
+
+  void signal() noexcept {
+    const uint64_t value = 1;
+    [[maybe_unused]] const auto _ = ::write(wake, &value, sizeof(value));
+  }
+
+  void submit(std::unique_ptr<async_io_request> request) {
+    // 'poll' ignores negative file descriptors.
+    if (request->fd < 0) return request->complete(-1);
+    {
+      std::scoped_lock lock{mutex};
+      incoming.push_back(std::move(request));
+    }
+    signal();
+  }
+
+  // Returns false if the operation would block.
+  //
+  static bool execute(async_io_request& r) {
+    using operation = async_io_request::operation;
+    const auto current = (r.offset == uint64(-1));
+    while (true) {
+      const auto count =
+          (r.op == operation::read)
+              ? (current ? ::read(r.fd, r.data, r.size)
+                         : ::pread(r.fd, r.data, r.size, r.offset))
+              : (current ? ::write(r.fd, r.data, r.size)
+                         : ::pwrite(r.fd, r.data, r.size, r.offset));
+      if (count == -1 && errno == EINTR) continue;
+      if (count == -1 && (errno == EAGAIN || errno == EWOULDBLOCK))
+        return false;
+      r.complete(count);
+      return true;
+    }
+  }
+
+  // The original flags of a file descriptor
+  // and the amount of its pending requests.
+  // Descriptors are only used by the background thread.
+  //
+  struct descriptor {
+    int flags;
+    size_t count;
+  };
+
+  void acquire(int fd) {
+    auto& d = descriptors[fd];
+    if (d.count++) return;
+    d.flags = ::fcntl(fd, F_GETFL);
+    if (d.flags != -1 && !(d.flags & O_NONBLOCK))
+      ::fcntl(fd, F_SETFL, d.flags | O_NONBLOCK);
+  }
+
+  void release(int fd) {
+    const auto it = descriptors.find(fd);
+    if (--it->second.count) return;
+    const auto flags = it->second.flags;
+    if (flags != -1 && !(flags & O_NONBLOCK)) ::fcntl(fd, F_SETFL, flags);
+    descriptors.erase(it);
+  }
+
+  void run() {
+    using operation = async_io_request::operation;
+    std::vector<std::unique_ptr<async_io_request>> requests{};
+    std::vector<pollfd> fds{};
+    while (true) {
+      {
+        std::scoped_lock lock{mutex};
+        if (shutdown) break;
+        for (auto& r : incoming) {
+          acquire(r->fd);
+          requests.push_back(std::move(r));
+        }
+        incoming.clear();
+      }
+      fds.clear();
+      fds.push_back({wake, POLLIN, 0});
+      for (const auto& r : requests)
+        fds.push_back(
+            {r->fd, short((r->op == operation::read) ? POLLIN : POLLOUT), 0});
+      if (::poll(fds.data(), fds.size(), -1) == -1) {
+        if (errno == EINTR) continue;
+        // Waiting failed for another reason than a signal.
+        // Retrying would only spin. So, fail all pending requests.
+        for (auto& r : requests) {
+          r->complete(-1);
+          release(r->fd);
+        }
+        requests.clear();
+        continue;
+      }
+      if (fds[0].revents) {
+        uint64_t value;
+        [[maybe_unused]] const auto _ = ::read(wake, &value, sizeof(value));
+      }
+      // Execute all ready operations and keep the others.
+      size_t kept = 0;
+      for (size_t i = 0; i < requests.size(); ++i) {
+        if (fds[i + 1].revents && execute(*requests[i]))
+          release(requests[i]->fd);
+        else
+          requests[kept++] = std::move(requests[i]);
+      }
+      requests.resize(kept);
+    }
+    // Abandoned requests do not keep their descriptors non-blocking.
+    for (auto& r : requests)
+      release(r->fd);
+  }
+
+  int wake;
+  std::mutex mutex{};
+  std::vector<std::unique_ptr<async_io_request>> incoming{};
+  bool shutdown = false;
+  std::unordered_map<int, descriptor> descriptors{};
+  std::thread worker{};
+};
+
+}  // namespace detail
+
+/// The 'async_file_io' asynchronously reads from and writes to
+/// files and pipes without spawning a thread per request.
+/// By default, requests are submitted through Linux io_uring.
+/// If io_uring is not available, a single 'poll'-based thread is used instead.
+/// It puts file descriptors into non-blocking mode
+/// while operations on them are pending.
+/// Every operation returns an 'async_state' that can be polled
+/// by 'available()' in the same style as 'async_line_read'.
+/// Its result is the number of transferred bytes
+/// which may be smaller than the buffer size, as for 'read' and 'write'.
+/// The given buffers need to stay alive until the operation has completed.
+/// Pending operations on destruction are abandoned.
+///
+struct async_file_io {
+  enum class backend { automatic, io_uring, poll };
+
+  /// Use this offset to read or write at the current file position.
+  /// For pipes, this is the only valid offset.
+  ///
+  static constexpr uint64 current_position = uint64(-1);
+
+  explicit async_file_io(backend b = backend::automatic,
+                         unsigned entries = 256) {
+    if (b == backend::poll) {
+      queue.emplace<detail::poll_io_queue>();
+      return;
+    }
+    try {
+      queue.emplace<detail::io_uring_queue>(entries);
+    } catch (std::runtime_error&) {
+      if (b == backend::io_uring) throw;
+      queue.emplace<detail::poll_io_queue>();
+    }
+  }
+
+  bool uses_io_uring() const noexcept {
+    return std::holds_alternative<detail::io_uring_queue>(queue);
+  }
+
+  auto read(int fd,
+            std::span<char> buffer,
+            uint64 offset = current_position) -> async_state<size_t> {
+    return submit(detail::async_io_request::operation::read, fd,
+                  buffer.data(), buffer.size(), offset);
+  }
+
+  auto write(int fd,
+             std::span<const char> buffer,
+             uint64 offset = current_position) -> async_state<size_t> {
+    return submit(detail::async_io_request::operation::write, fd,
+                  const_cast<char*>(buffer.data()), buffer.size(), offset);
+  }
+
+  auto submit(detail::async_io_request::operation op,
+              int fd,
+              char* data,
+              size_t size,
+              uint64 offset) -> async_state<size_t> {
+    auto request = std::make_unique<detail::async_io_request>(
+        detail::async_io_request{op, fd, data, size, offset});
+    auto result = request->result.get_future();
+    std::visit(
+        [&](auto& q) {
+          if constexpr (requires { q.submit(std::move(request)); })
+            q.submit(std::move(request));
+        },
+        queue);
+    return result;
+  }
+
+  std::variant<std::monostate, detail::io_uring_queue, detail::poll_io_queue>
+      queue{};
+};
+
+#endif  // defined(__linux__)
+
 }  // namespace lyrahgames::xstd
@@ -1,33 +1,349 @@
 #pragma once
+#include <algorithm>
 #include <chrono>
+#include <cmath>
 #include <concepts>
 #include <functional>
+#include <thread>
+#include <vector>
+//
+#if defined(__x86_64__)
+#include <cpuid.h>
+#include <x86intrin.h>
+#endif
 //
 #include <lyrahgames/xstd/meta.hpp>
 #include <lyrahgames/xstd/utility.hpp>
 
 namespace lyrahgames::xstd {
 
+/// Prevent the compiler from optimizing away the computation of the value.
+/// The value is assumed to be read by the empty assembler statement.
+/// In contrast to a 'volatile' copy, no additional copy is made.
+///
+template <typename T>
+inline void do_not_optimize(const T& value) noexcept {
+  asm volatile("" : : "r,m"(value) : "memory");
+}
+/// For non-constant values, the compiler additionally has to assume
+/// that the value has been modified and cannot propagate it as constant.
+///
+template <typename T>
+inline void do_not_optimize(T& value) noexcept {
+  asm volatile("" : "+r,m"(value) : : "memory");
+}
+
+/// Prevent the compiler from reordering or eliding memory accesses
+/// across this point by forcing all pending writes to be visible.
+///
+inline void clobber_memory() noexcept {
+  asm volatile("" : : : "memory");
+}
+
+/// The 'tsc_clock' reads the time stamp counter of x86 processors.
+/// Reading the counter costs only a few nanoseconds
+/// and is therefore suited to instrument tiny hot-path sections.
+/// The tick rate is calibrated once against 'std::chrono::steady_clock'
+/// and ticks are converted to nanoseconds by a fixed-point multiplication.
+/// To get reliable results, the processor needs an invariant TSC.
+/// If it does not report one or the counter does not advance,
+/// as in some virtual machines,
+/// 'std::chrono::steady_clock' is used instead.
+/// The same is done on other architectures.
+/// So, the clock is steady in every case.
+/// It fulfills the standard clock requirements
+/// and can be used as clock parameter of 'duration'.
+///
+struct tsc_clock {
+  using rep = int64;
+  using period = std::nano;
+  using duration = std::chrono::nanoseconds;
+  using time_point = std::chrono::time_point<tsc_clock>;
+  static constexpr bool is_steady = true;
+
+  /// Read the counter at the start of a measured section.
+  /// The fences make sure that no previous instruction
+  /// is still executed when the counter is read
+  /// and that no following instruction starts before.
+  ///
+  static auto ticks() noexcept -> uint64 {
+#if defined(__x86_64__)
+    if (calibration().tsc) return counter();
+#endif
+    return steady_ticks();
+  }
+
+  /// Read the counter at the end of a measured section.
+  /// 'rdtscp' waits until all previous instructions have been executed.
+  ///
+  static auto serialized_ticks() noexcept -> uint64 {
+#if defined(__x86_64__)
+    if (calibration().tsc) return serialized_counter();
+#endif
+    return steady_ticks();
+  }
+
+#if defined(__x86_64__)
+  static auto counter() noexcept -> uint64 {
+    _mm_lfence();
+    const auto result = __rdtsc();
+    _mm_lfence();
+    return result;
+  }
+
+  static auto serialized_counter() noexcept -> uint64 {
+    unsigned int aux;
+    const auto result = __rdtscp(&aux);
+    _mm_lfence();
+    return result;
+  }
+#endif
+
+  static auto steady_ticks() noexcept -> uint64 {
+    return std::chrono::steady_clock::now().time_since_epoch().count();
+  }
+
+  /// Checks whether the processor reports an invariant TSC
+  /// whose rate does not depend on frequency scaling or sleep states.
+  ///
+  static bool invariant() noexcept {
+#if defined(__x86_64__)
+    unsigned int a, b, c, d;
+    if (!__get_cpuid(0x80000007, &a, &b, &c, &d)) return false;
+    return d & (1u << 8);
+#else
+    return true;
+#endif
+  }
+
+  // The conversion factor from ticks to nanoseconds
+  // is stored as a 32.32 fixed-point number.
+  // If the time stamp counter cannot be used,
+  // the ticks are the ones of 'std::chrono::steady_clock'.
+  //
+  struct calibration_data {
+    float64 frequency;
+    uint64 scale;
+    bool tsc;
+  };
+
+  static auto calibrate(std::chrono::milliseconds time =
+                            std::chrono::milliseconds{20}) -> calibration_data {
+    using namespace std::chrono;
+#if defined(__x86_64__)
+    if (invariant()) {
+      const auto start_time = steady_clock::now();
+      const auto start_ticks = counter();
+      std::this_thread::sleep_for(time);
+      const auto end_ticks = counter();
+      const auto end_time = steady_clock::now();
+      const auto ns =
+          duration_cast<nanoseconds>(end_time - start_time).count();
+      const auto count = end_ticks - start_ticks;
+      if (count > 0 && ns > 0)
+        return {1e9 * count / ns,
+                uint64((static_cast<unsigned __int128>(ns) << 32) / count),
+                true};
+    }
+#endif
+    using ratio = std::ratio_divide<steady_clock::period, std::nano>;
+    return {1e9 * ratio::den / ratio::num,
+            (uint64{1} << 32) * ratio::num / ratio::den, false};
+  }
+
+  /// The calibration is done once on first use.
+  ///
+  static auto calibration() noexcept -> const calibration_data& {
+    static const auto data = calibrate();
+    return data;
+  }
+
+  /// Returns the calibrated amount of ticks per second.
+  ///
+  static auto frequency() -> float64 { return calibration().frequency; }
+
+  static auto to_duration(uint64 ticks) -> duration {
+    return to_duration(ticks, calibration());
+  }
+
+  static auto to_duration(uint64 ticks, const calibration_data& data)
+      -> duration {
+#if defined(__SIZEOF_INT128__)
+    const auto ns = uint64(
+        (static_cast<unsigned __int128>(ticks) * data.scale) >> 32);
+#else
+    // Without 128-bit integers, the product is assembled from 32-bit halves.
+    // Only its bits from 32 to 95 are needed.
+    const uint64 th = ticks >> 32, tl = uint32(ticks);
+    const uint64 sh = data.scale >> 32, sl = uint32(data.scale);
+    const auto ns = ((th * sh) << 32) + th * sl + tl * sh + ((tl * sl) >> 32);
+#endif
+    return duration{rep(ns)};
+  }
+
+  /// The calibration is fetched before the counter is read.
+  /// So, the first call does not include the calibration time.
+  ///
+  static auto now() noexcept -> time_point { return start(); }
+
+  /// Time points at the start and the end of a measured section.
+  /// They use the respective fences of 'ticks' and 'serialized_ticks'.
+  ///
+  static auto start() noexcept -> time_point {
+    const auto& data = calibration();
+    return time_point{to_duration(ticks(), data)};
+  }
+  static auto stop() noexcept -> time_point {
+    const auto& data = calibration();
+    return time_point{to_duration(serialized_ticks(), data)};
+  }
+};
+
+namespace detail {
+
+// Clocks providing fenced time points for measured sections
+// use them instead of 'now'.
+//
+template <typename clock>
+inline auto start_time() {
+  if constexpr (requires { clock::start(); })
+    return clock::start();
+  else
+    return clock::now();
+}
+
+template <typename clock>
+inline auto stop_time() {
+  if constexpr (requires { clock::stop(); })
+    return clock::stop();
+  else
+    return clock::now();
+}
+
+}  // namespace detail
+
 // Measure the duration of a given function by using perfect forwarding.
-template <typename base = float64, typename functor, typename... arguments>
+// The clock can be exchanged, for example, by the 'tsc_clock'.
+template <typename base = float64,
+          typename clock = std::chrono::high_resolution_clock,
+          typename functor,
+          typename... arguments>
 requires std::invocable<functor, arguments...>  //
 inline auto duration(functor&& f, arguments&&... args) {
   using namespace std;
-  using clock = chrono::high_resolution_clock;
 
-  const auto start = clock::now();
+  const auto start = detail::start_time<clock>();
 
   // If the function has a return value,
   // we make sure to get it such that
   // the compiler does not optimize it away.
-  if constexpr (!meta::equal<void, meta::result<functor>>)
-    volatile auto result =
+  if constexpr (!meta::equal<void, meta::result<functor>>) {
+    const auto& result =
         std::invoke(std::forward<functor>(f), std::forward<arguments>(args)...);
-  else
+    do_not_optimize(result);
+  } else
     std::invoke(std::forward<functor>(f), std::forward<arguments>(args)...);
 
-  const auto end = clock::now();
+  const auto end = detail::stop_time<clock>();
   return chrono::duration<base>(end - start);
 }
 
+/// Options to control the statistical benchmark runner.
+///
+struct benchmark_options {
+  /// The function is called without measurement for at least this time
+  /// to warm up caches, branch predictors, and CPU frequency.
+  std::chrono::duration<float64> warmup_time{0.05};
+  /// The amount of iterations per sample is scaled
+  /// such that every sample takes at least this time.
+  std::chrono::duration<float64> sample_time{0.002};
+  /// The amount of samples to collect.
+  size_t samples = 100;
+};
+
+/// The result of a benchmark stores the time per iteration of all samples.
+/// The samples are sorted in ascending order
+/// to be able to directly compute order statistics.
+///
+template <typename base = float64>
+struct benchmark_result {
+  using duration_type = std::chrono::duration<base>;
+
+  auto min() const { return samples.front(); }
+  auto max() const { return samples.back(); }
+  auto median() const { return percentile(50); }
+
+  auto mean() const {
+    duration_type sum{};
+    for (auto x : samples)
+      sum += x;
+    return sum / samples.size();
+  }
+
+  /// Returns the sample standard deviation.
+  ///
+  auto stddev() const {
+    if (samples.size() < 2) return duration_type{};
+    const auto m = mean().count();
+    base sum{};
+    for (auto x : samples)
+      sum += (x.count() - m) * (x.count() - m);
+    return duration_type{std::sqrt(sum / (samples.size() - 1))};
+  }
+
+  /// Returns the given percentile in [0, 100]
+  /// by linear interpolation of the sorted samples.
+  ///
+  auto percentile(base p) const {
+    const auto x = std::clamp<base>(p, 0, 100) / 100 * (samples.size() - 1);
+    const auto i = static_cast<size_t>(x);
+    if (i + 1 >= samples.size()) return samples.back();
+    return samples[i] + (x - i) * (samples[i + 1] - samples[i]);
+  }
+
+  size_t iterations{};
+  std::vector<duration_type> samples{};
+};
+
+/// Statistical micro-benchmark of the given function.
+/// After a warm-up phase, the iteration count per sample is doubled
+/// until a sample takes at least the given sample time.
+/// Afterwards, the given amount of samples is collected.
+/// The result of the function is kept alive by 'do_not_optimize'.
+///
+template <typename base = float64,
+          typename clock = std::chrono::steady_clock,
+          typename functor>
+requires std::invocable<functor&>  //
+inline auto benchmark(functor&& f, const benchmark_options& options = {}) {
+  using namespace std;
+  using duration_type = typename benchmark_result<base>::duration_type;
+
+  const auto run = [&](size_t iterations) {
+    const auto start = detail::start_time<clock>();
+    for (size_t i = 0; i < iterations; ++i) {
+      if constexpr (!meta::equal<void, invoke_result_t<functor&>>)
+        do_not_optimize(std::invoke(f));
+      else
+        std::invoke(f);
+      clobber_memory();
+    }
+    return duration_type(detail::stop_time<clock>() - start);
+  };
+
+  const auto warmup_end = clock::now() + options.warmup_time;
+  while (clock::now() < warmup_end)
+    run(1);
+
+  benchmark_result<base> result{1};
+  while (run(result.iterations) < options.sample_time)
+    result.iterations *= 2;
+
+  result.samples.reserve(options.samples);
+  for (size_t i = 0; i < max<size_t>(options.samples, 1); ++i)
+    result.samples.push_back(run(result.iterations) / result.iterations);
+  ranges::sort(result.samples);
+  return result;
+}
+
 }  // namespace lyrahgames::xstd
@@ -0,0 +1,208 @@
+#pragma once
+#include <condition_variable>
+#include <coroutine>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <optional>
+#include <utility>
+//
+#include <lyrahgames/xstd/utility.hpp>
+
+namespace lyrahgames::xstd {
+
+// This header provides a minimal set of types
+// to write sequential-looking asynchronous code with C++20 coroutines.
+// A 'task' is a lazily started coroutine that can be awaited by other tasks.
+// The 'task_executor' resumes coroutines on a single thread
+// and sleeps while no coroutine is ready to continue.
+// Other threads, such as background readers, hand suspended coroutines
+// back to the executor by 'post'.
+
+template <typename T = void>
+struct task;
+
+namespace detail {
+
+struct task_promise_base {
+  // When a task has finished,
+  // its awaiting coroutine is directly resumed by symmetric transfer.
+  struct final_awaiter {
+    bool await_ready() noexcept { return false; }
+    template <typename promise>
+    auto await_suspend(std::coroutine_handle<promise> h) noexcept
+        -> std::coroutine_handle<> {
+      return h.promise().continuation;
+    }
+    void await_resume() noexcept {}
+  };
+
+  auto initial_suspend() noexcept { return std::suspend_always{}; }
+  auto final_suspend() noexcept { return final_awaiter{}; }
+  void unhandled_exception() noexcept { error = std::current_exception(); }
+
+  std::coroutine_handle<> continuation = std::noop_coroutine();
+  std::exception_ptr error{};
+};
+
+template <typename T>
+struct task_promise : task_promise_base {
+  auto get_return_object() noexcept -> task<T>;
+  void return_value(T x) { value.emplace(std::move(x)); }
+  auto result() -> T {
+    if (error) std::rethrow_exception(error);
+    return std::move(*value);
+  }
+  std::optional<T> value{};
+};
+
+template <>
+struct task_promise<void> : task_promise_base {
+  auto get_return_object() noexcept -> task<void>;
+  void return_void() noexcept {}
+  void result() {
+    if (error) std::rethrow_exception(error);
+  }
+};
+
+}  // namespace detail
+
+/// A 'task' owns a coroutine which is started when it is awaited.
+/// Awaiting a task returns its result or rethrows its exception.
+///
+template <typename T>
+struct task {
+  using promise_type = detail::task_promise<T>;
+  using handle_type = std::coroutine_handle<promise_type>;
+
+  explicit task(handle_type h) noexcept : handle{h} {}
+
+  task(const task&) = delete;
+  task& operator=(const task&) = delete;
+
+  task(task&& x) noexcept : handle{std::exchange(x.handle, nullptr)} {}
+  task& operator=(task&& x) noexcept {
+    std::swap(handle, x.handle);
+    return *this;
+  }
+
+  ~task() noexcept {
+    if (handle) handle.destroy();
+  }
+
+  bool done() const noexcept { return !handle || handle.done(); }
+
+  bool await_ready() const noexcept { return done(); }
+  auto await_suspend(std::coroutine_handle<> h) noexcept {
+    handle.promise().continuation = h;
+    return handle;
+  }
+  auto await_resume() -> T { return handle.promise().result(); }
+
+  handle_type handle;
+};
+
+namespace detail {
+
+template <typename T>
+inline auto task_promise<T>::get_return_object() noexcept -> task<T> {
+  return task<T>{task<T>::handle_type::from_promise(*this)};
+}
+
+inline auto task_promise<void>::get_return_object() noexcept -> task<void> {
+  return task<void>{task<void>::handle_type::from_promise(*this)};
+}
+
+}  // namespace detail
+
+/// The 'task_executor' runs spawned tasks on the thread that calls 'run'.
+/// Ready coroutines are kept in a queue that can be filled from any thread.
+/// If the queue is empty, the executor blocks on a condition variable.
+/// So, waiting for input does not need any polling or wasted wakeups.
+///
+struct task_executor {
+  task_executor() = default;
+  task_executor(const task_executor&) = delete;
+  task_executor& operator=(const task_executor&) = delete;
+
+  /// Schedule the given coroutine to be resumed by the executor.
+  /// This function can be called from any thread.
+  ///
+  void post(std::coroutine_handle<> h) {
+    {
+      std::scoped_lock lock{mutex};
+      ready.push_back(h);
+    }
+    wake.notify_one();
+  }
+
+  /// Awaiting the result of this function moves
+  /// the current coroutine to the end of the ready queue.
+  ///
+  auto schedule() noexcept {
+    struct awaiter {
+      bool await_ready() noexcept { return false; }
+      void await_suspend(std::coroutine_handle<> h) { executor.post(h); }
+      void await_resume() noexcept {}
+      task_executor& executor;
+    };
+    return awaiter{*this};
+  }
+
+  /// Take over the ownership of the given task and schedule its start.
+  /// It will run the next time the executor is running.
+  ///
+  void spawn(task<void> t) {
+    ++running;
+    post(drive(*this, std::move(t)).handle);
+  }
+
+  /// Resume ready coroutines until all spawned tasks have finished.
+  /// The first exception that escaped from a spawned task is rethrown.
+  ///
+  void run() {
+    while (running > 0) {
+      std::unique_lock lock{mutex};
+      wake.wait(lock, [this] { return !ready.empty(); });
+      const auto h = ready.front();
+      ready.pop_front();
+      lock.unlock();
+      h.resume();
+    }
+    if (error) std::rethrow_exception(std::exchange(error, nullptr));
+  }
+
+  // Spawned tasks are awaited by a detached coroutine
+  // that destroys itself when the task has finished.
+  //
+  struct detached {
+    struct promise_type {
+      auto get_return_object() noexcept {
+        using handle_type = std::coroutine_handle<promise_type>;
+        return detached{handle_type::from_promise(*this)};
+      }
+      auto initial_suspend() noexcept { return std::suspend_always{}; }
+      auto final_suspend() noexcept { return std::suspend_never{}; }
+      void return_void() noexcept {}
+      void unhandled_exception() noexcept { std::terminate(); }
+    };
+    std::coroutine_handle<promise_type> handle;
+  };
+
+  static auto drive(task_executor& executor, task<void> t) -> detached {
+    try {
+      co_await t;
+    } catch (...) {
+      if (!executor.error) executor.error = std::current_exception();
+    }
+    --executor.running;
+  }
+
+  std::mutex mutex{};
+  std::condition_variable wake{};
+  std::deque<std::coroutine_handle<>> ready{};
+  size_t running = 0;
+  std::exception_ptr error{};
+};
+
+}  // namespace lyrahgames::xstd
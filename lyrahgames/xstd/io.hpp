@@ -12,26 +12,770 @@
 #include <iostream>
 #include <sstream>
 
+// File contents are provided as views into owned or caller-owned buffers.
+//
+#include <algorithm>
+#include <iterator>
+#include <memory>
+#include <ranges>
+#include <span>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+// Many files can be loaded concurrently.
+//
+#include <atomic>
+#include <exception>
+#include <filesystem>
+#include <thread>
+
+// Unbuffered file access and memory maps are provided by POSIX.
+//
+#include <cerrno>
+#include <climits>
+#include <cstring>
+//
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
 namespace lyrahgames::xstd {
 
+/// The 'file_descriptor' owns a POSIX file descriptor
+/// and makes sure that it is closed when it goes out of scope.
+/// It is the common base for all unbuffered file access in this module.
+///
+struct file_descriptor {
+  file_descriptor() noexcept = default;
+  explicit file_descriptor(int fd) noexcept : fd_{fd} {}
+
+  file_descriptor(const file_descriptor&) = delete;
+  file_descriptor& operator=(const file_descriptor&) = delete;
+
+  file_descriptor(file_descriptor&& x) noexcept
+      : fd_{std::exchange(x.fd_, -1)} {}
+
+  file_descriptor& operator=(file_descriptor&& x) noexcept {
+    std::swap(fd_, x.fd_);
+    return *this;
+  }
+
+  ~file_descriptor() noexcept { close(); }
+
+  void close() noexcept {
+    if (fd_ != -1) ::close(fd_);
+    fd_ = -1;
+  }
+
+  auto get() const noexcept { return fd_; }
+  auto release() noexcept { return std::exchange(fd_, -1); }
+  explicit operator bool() const noexcept { return fd_ != -1; }
+
+  /// Returns the size of the file in bytes.
+  ///
+  auto size() const -> size_t {
+    struct stat info;
+    if (::fstat(fd_, &info) == -1)
+      throw std::runtime_error("Failed to get the size of the file.");
+    return info.st_size;
+  }
+
+  /// Linux transfers at most 0x7ffff000 bytes per system call
+  /// and other systems fail for sizes above 2 GiB.
+  /// Hence, large reads are split into blocks of the following size.
+  ///
+  static constexpr size_t max_transfer_size = size_t{1} << 30;
+
+  /// Reads at most 'buffer.size()' bytes and returns their count.
+  /// Interrupted system calls are retried.
+  /// A return value of zero means that the end of the file has been reached.
+  ///
+  auto read(std::span<char> buffer) const -> size_t {
+    const auto size = std::min(buffer.size(), max_transfer_size);
+    while (true) {
+      const auto count = ::read(fd_, buffer.data(), size);
+      if (count >= 0) return count;
+      if (errno != EINTR)
+        throw std::runtime_error("Failed to read from the file.");
+    }
+  }
+
+  /// Reads bytes starting at the given file offset
+  /// until the buffer is full or the end of the file has been reached.
+  /// The file position is not changed by this function.
+  ///
+  auto read_at(std::span<char> buffer, size_t offset) const -> size_t {
+    size_t size = 0;
+    while (size < buffer.size()) {
+      const auto count =
+          ::pread(fd_, buffer.data() + size,
+                  std::min(buffer.size() - size, max_transfer_size),
+                  offset + size);
+      if (count == 0) break;
+      if (count > 0)
+        size += count;
+      else if (errno != EINTR)
+        throw std::runtime_error("Failed to read from the file.");
+    }
+    return size;
+  }
+
+  /// Writes all bytes of the given buffer.
+  /// Interrupted system calls and partial writes are continued.
+  ///
+  void write(std::span<const char> buffer) const {
+    while (!buffer.empty()) {
+      const auto count = ::write(fd_, buffer.data(),
+                                 std::min(buffer.size(), max_transfer_size));
+      if (count >= 0)
+        buffer = buffer.subspan(count);
+      else if (errno != EINTR)
+        throw std::runtime_error("Failed to write to the file.");
+    }
+  }
+
+  /// Writes all given buffers in order with as few system calls as possible
+  /// by using scatter-gather output.
+  /// The given array is modified to keep track of partial writes.
+  ///
+  void write(std::span<iovec> buffers) const {
+    while (!buffers.empty()) {
+      const auto count =
+          ::writev(fd_, buffers.data(),
+                   std::min<size_t>(buffers.size(), IOV_MAX));
+      if (count < 0) {
+        if (errno == EINTR) continue;
+        throw std::runtime_error("Failed to write to the file.");
+      }
+      // Skip all buffers that have been fully written
+      // and advance into the partially written one.
+      auto rest = size_t(count);
+      while (!buffers.empty() && rest >= buffers.front().iov_len) {
+        rest -= buffers.front().iov_len;
+        buffers = buffers.subspan(1);
+      }
+      if (rest > 0) {
+        buffers.front().iov_base =
+            static_cast<char*>(buffers.front().iov_base) + rest;
+        buffers.front().iov_len -= rest;
+      }
+    }
+  }
+
+  int fd_ = -1;
+};
+
+/// Open a file for reading by using its POSIX file descriptor.
+/// Throws the same exception as 'string_from_file'.
+///
+inline auto open_file(czstring file_path) -> file_descriptor {
+  using namespace std;
+  file_descriptor file{::open(file_path, O_RDONLY | O_CLOEXEC)};
+  if (!file)
+    throw runtime_error("Failed to open the file '"s + file_path + "'.");
+  return file;
+}
+
 // 'czstring' is used because the given file path is only read once.
+// The file is read by using its POSIX file descriptor with 'pread'
+// to not go through the iostream layer.
+// If the standard library supports it,
+// the string will not be zero-initialized before reading.
 //
 inline auto string_from_file(czstring file_path) -> std::string {
   using namespace std;
-  // We will read all characters as block.
-  // Hence, open the file in binary mode.
-  // Make sure to jump to its end for directly reading its size.
-  ifstream file{file_path, ios::binary | ios::ate};
-  if (!file)
-    throw runtime_error("Failed to open the file '"s + file_path + "'.");
-  // Read the file size.
-  auto size = file.tellg();
-  // Prepare the result string with a sufficiently large buffer.
-  string result(size, '\0');
-  // Go back to the start and read all characters at once.
-  file.seekg(0);
-  file.read(result.data(), size);
+  const auto file = open_file(file_path);
+  const auto size = file.size();
+  string result{};
+#ifdef __cpp_lib_string_resize_and_overwrite
+  // The operation given to 'resize_and_overwrite' is not allowed to throw.
+  exception_ptr error{};
+  result.resize_and_overwrite(size, [&](char* data, size_t size) noexcept {
+    try {
+      return file.read_at({data, size}, 0);
+    } catch (...) {
+      error = current_exception();
+      return size_t{0};
+    }
+  });
+  if (error) rethrow_exception(error);
+#else
+  result.resize(size);
+  result.resize(file.read_at(result, 0));
+#endif
   return result;
+}
+
+/// The 'file_buffer' owns the whole content of a file
+/// inside an uninitialized heap buffer.
+/// In contrast to 'std::string', its storage is never zero-filled
+/// before the content is read.
+///
+struct file_buffer {
+  auto data() noexcept -> zstring { return data_.get(); }
+  auto data() const noexcept -> czstring { return data_.get(); }
+  auto size() const noexcept -> size_t { return size_; }
+  bool empty() const noexcept { return size_ == 0; }
+
+  auto begin() const noexcept -> czstring { return data_.get(); }
+  auto end() const noexcept -> czstring { return data_.get() + size_; }
+
+  /// Access the content as characters or as raw bytes.
+  ///
+  auto view() const noexcept -> std::string_view { return {data(), size_}; }
+  auto bytes() const noexcept -> std::span<const std::byte> {
+    return {reinterpret_cast<const std::byte*>(data()), size_};
+  }
+
+  operator std::string_view() const noexcept { return view(); }
+
+  std::unique_ptr<char[]> data_{};
+  size_t size_ = 0;
+};
+
+/// Read the whole content of a file into an uninitialized buffer.
+/// Reads of large files are split into multiple 'pread' calls.
+/// Throws the same exception as 'string_from_file'.
+///
+inline auto buffer_from_file(czstring file_path) -> file_buffer {
+  const auto file = open_file(file_path);
+  const auto size = file.size();
+  file_buffer result{std::make_unique_for_overwrite<char[]>(size)};
+  result.size_ = file.read_at({result.data_.get(), size}, 0);
+  return result;
+}
+
+/// The 'mapped_file' is a read-only view of the whole content of a file.
+/// Instead of copying all bytes into a newly allocated string,
+/// the file is mapped into the virtual address space of the process.
+/// Pages are then loaded lazily by the kernel from the page cache.
+/// For callers that only parse the content, this is a zero-copy
+/// alternative to 'string_from_file' with the same error semantics.
+///
+struct mapped_file {
+  /// Hints for the kernel how the mapped memory will be accessed.
+  /// They are directly forwarded to 'madvise'.
+  ///
+  enum class advice : int {
+    normal = MADV_NORMAL,
+    sequential = MADV_SEQUENTIAL,
+    random = MADV_RANDOM,
+    will_need = MADV_WILLNEED,
+  };
+
+  mapped_file() noexcept = default;
+
+  explicit mapped_file(czstring file_path, advice hint = advice::sequential) {
+    using namespace std;
+    const auto file = open_file(file_path);
+    size_ = file.size();
+    // Mapping zero bytes is not allowed.
+    // Empty files are represented by an empty view.
+    // The mapping stays valid after closing its file descriptor.
+    if (size_ > 0) {
+      const auto ptr =
+          ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, file.get(), 0);
+      if (ptr == MAP_FAILED)
+        throw runtime_error("Failed to map the file '"s + file_path + "'.");
+      data_ = static_cast<const char*>(ptr);
+    }
+    advise(hint);
+  }
+
+  // Mappings cannot be shared and are therefore not copyable.
+  //
+  mapped_file(const mapped_file&) = delete;
+  mapped_file& operator=(const mapped_file&) = delete;
+
+  mapped_file(mapped_file&& x) noexcept
+      : data_{std::exchange(x.data_, nullptr)},
+        size_{std::exchange(x.size_, 0)} {}
+
+  mapped_file& operator=(mapped_file&& x) noexcept {
+    swap(*this, x);
+    return *this;
+  }
+
+  ~mapped_file() noexcept { unmap(); }
+
+  friend void swap(mapped_file& x, mapped_file& y) noexcept {
+    std::swap(x.data_, y.data_);
+    std::swap(x.size_, y.size_);
+  }
+
+  /// Give the kernel a new hint on how to access the mapped pages.
+  /// Hints are only advisory and their failure is therefore ignored.
+  ///
+  void advise(advice hint) const noexcept {
+    if (data_)
+      ::madvise(const_cast<char*>(data_), size_, static_cast<int>(hint));
+  }
+
+  /// Release the mapping before the destructor would do so.
+  ///
+  void unmap() noexcept {
+    if (data_) ::munmap(const_cast<char*>(data_), size_);
+    data_ = nullptr;
+    size_ = 0;
+  }
+
+  auto data() const noexcept -> czstring { return data_; }
+  auto size() const noexcept -> size_t { return size_; }
+  bool empty() const noexcept { return size_ == 0; }
+
+  auto begin() const noexcept -> czstring { return data_; }
+  auto end() const noexcept -> czstring { return data_ + size_; }
+
+  /// Access the content as characters or as raw bytes.
+  ///
+  auto view() const noexcept -> std::string_view { return {data_, size_}; }
+  auto bytes() const noexcept -> std::span<const std::byte> {
+    return {reinterpret_cast<const std::byte*>(data_), size_};
+  }
+
+  operator std::string_view() const noexcept { return view(); }
+
+  const char* data_ = nullptr;
+  size_t size_ = 0;
 };
 
+/// The 'chunk_reader' streams the content of a file
+/// in chunks of fixed size through a buffer that is owned by the caller.
+/// The buffer is reused for every chunk such that memory consumption
+/// stays constant regardless of the file size.
+/// The returned chunks are only valid until the next chunk is read.
+///
+/// for (auto chunk : chunk_reader{"file.txt", buffer}) ...
+///
+struct chunk_reader {
+  chunk_reader(czstring file_path, std::span<char> buffer)
+      : file{open_file(file_path)}, buffer{buffer} {
+    if (buffer.empty())
+      throw std::invalid_argument("Chunk buffer must not be empty.");
+  }
+
+  /// Read the next chunk.
+  /// An empty chunk marks the end of the file.
+  ///
+  auto next() -> std::string_view {
+    chunk = {buffer.data(), file.read(buffer)};
+    return chunk;
+  }
+
+  // Provide an input range for range-based for loops.
+  //
+  struct iterator {
+    using value_type = std::string_view;
+    using difference_type = std::ptrdiff_t;
+
+    auto operator*() const noexcept { return reader->chunk; }
+    auto& operator++() {
+      reader->next();
+      return *this;
+    }
+    void operator++(int) { ++*this; }
+    bool operator==(std::default_sentinel_t) const noexcept {
+      return reader->chunk.empty();
+    }
+
+    chunk_reader* reader;
+  };
+
+  auto begin() -> iterator {
+    next();
+    return {this};
+  }
+  auto end() const noexcept { return std::default_sentinel; }
+
+  file_descriptor file;
+  std::span<char> buffer;
+  std::string_view chunk{};
+};
+
+/// The 'line_reader' is a line-splitting adapter on top of chunk-wise reading.
+/// Lines are returned without their terminating newline character
+/// as views into the given buffer which is owned by the caller.
+/// Lines crossing chunk boundaries are moved to the front of the buffer
+/// before the next chunk is appended.
+/// Only if a single line does not fit into the buffer, it will be enlarged.
+/// Hence, no allocation is done per line.
+/// The returned lines are only valid until the next line is read.
+///
+/// for (auto line : line_reader{"file.txt", buffer}) ...
+///
+struct line_reader {
+  static constexpr size_t default_chunk_size = size_t{1} << 16;
+
+  line_reader(czstring file_path, std::string& buffer)
+      : file{open_file(file_path)}, buffer{buffer} {
+    if (buffer.empty()) buffer.resize(default_chunk_size);
+  }
+
+  /// Read the next line and return whether there has been one.
+  /// Afterwards, the line can be accessed by the member 'line'.
+  ///
+  bool next() {
+    while (true) {
+      const auto rest = last - first;
+      const auto start = buffer.data() + first;
+      const auto p = static_cast<const char*>(std::memchr(start, '\n', rest));
+      if (p) {
+        line = {start, size_t(p - start)};
+        first += line.size() + 1;
+        return true;
+      }
+      if (eof) {
+        // The last line does not need to end with a newline character.
+        line = {start, rest};
+        first = last;
+        return rest > 0;
+      }
+      // Keep the beginning of the current line.
+      if (first > 0) {
+        std::memmove(buffer.data(), start, rest);
+        first = 0;
+        last = rest;
+      }
+      if (last == buffer.size()) buffer.resize(2 * buffer.size());
+      const auto count =
+          file.read({buffer.data() + last, buffer.size() - last});
+      eof = (count == 0);
+      last += count;
+    }
+  }
+
+  // Provide an input range for range-based for loops.
+  //
+  struct iterator {
+    using value_type = std::string_view;
+    using difference_type = std::ptrdiff_t;
+
+    auto operator*() const noexcept { return reader->line; }
+    auto& operator++() {
+      done = !reader->next();
+      return *this;
+    }
+    void operator++(int) { ++*this; }
+    bool operator==(std::default_sentinel_t) const noexcept { return done; }
+
+    line_reader* reader;
+    bool done = false;
+  };
+
+  auto begin() -> iterator {
+    iterator it{this};
+    return ++it;
+  }
+  auto end() const noexcept { return std::default_sentinel; }
+
+  file_descriptor file;
+  std::string& buffer;
+  size_t first = 0;
+  size_t last = 0;
+  bool eof = false;
+  std::string_view line{};
+};
+
+/// The 'file_batch' stores the content of many files
+/// inside a single contiguous arena
+/// to avoid a separate allocation for every file.
+/// Files that could not be loaded are marked by their error.
+///
+struct file_batch {
+  struct entry {
+    size_t offset = 0;
+    size_t size = 0;
+    std::exception_ptr error{};
+  };
+
+  auto size() const noexcept { return entries.size(); }
+  bool empty() const noexcept { return entries.empty(); }
+
+  bool failed(size_t index) const noexcept {
+    return bool(entries[index].error);
+  }
+  auto error(size_t index) const noexcept { return entries[index].error; }
+
+  /// Access the content of the file with the given index.
+  /// If the file could not be loaded, its error is rethrown.
+  ///
+  auto operator[](size_t index) const -> std::string_view {
+    const auto& e = entries[index];
+    if (e.error) std::rethrow_exception(e.error);
+    return {arena.get() + e.offset, e.size};
+  }
+
+  std::unique_ptr<char[]> arena{};
+  std::vector<entry> entries{};
+};
+
+namespace detail {
+
+// Paths may be given as C strings, strings, or filesystem paths.
+//
+inline auto path_cstr(czstring path) noexcept { return path; }
+inline auto path_cstr(const std::string& path) noexcept { return path.c_str(); }
+inline auto path_cstr(const std::filesystem::path& path) noexcept {
+  return path.c_str();
+}
+
+// Call the given function for all indices in [0, count)
+// by distributing them dynamically over a bounded amount of worker threads.
+// The function must not throw.
+//
+inline void parallel_for(size_t count, size_t thread_count, auto&& f) {
+  if (thread_count == 0) thread_count = std::thread::hardware_concurrency();
+  thread_count = std::clamp<size_t>(thread_count, 1, count);
+  std::atomic<size_t> next{0};
+  const auto work = [&] {
+    for (auto i = next++; i < count; i = next++)
+      f(i);
+  };
+  std::vector<std::thread> workers{};
+  workers.reserve(thread_count - 1);
+  for (size_t i = 1; i < thread_count; ++i)
+    workers.emplace_back(work);
+  work();
+  for (auto& worker : workers)
+    worker.join();
+}
+
+}  // namespace detail
+
+/// Load the content of all given files concurrently
+/// by using a bounded pool of worker threads.
+/// A thread count of zero means to use all hardware threads.
+/// In a first pass, the sizes of all files are queried
+/// to allocate one uninitialized arena for their content.
+/// In a second pass, the files are read directly into their arena slots.
+/// Errors are reported per file and do not stop the loading of other files.
+///
+template <std::ranges::random_access_range R>
+inline auto strings_from_files(const R& paths, size_t thread_count = 0)
+    -> file_batch {
+  using namespace std;
+  file_batch result{};
+  const auto count = size_t(ranges::size(paths));
+  result.entries.resize(count);
+  if (count == 0) return result;
+
+  const auto error = [](auto path) {
+    return make_exception_ptr(
+        runtime_error("Failed to open the file '"s + path + "'."));
+  };
+
+  detail::parallel_for(count, thread_count, [&](size_t i) {
+    const auto path = detail::path_cstr(ranges::begin(paths)[i]);
+    struct stat info;
+    if (::stat(path, &info) == -1)
+      result.entries[i].error = error(path);
+    else
+      result.entries[i].size = info.st_size;
+  });
+
+  size_t offset = 0;
+  for (auto& e : result.entries) {
+    e.offset = offset;
+    offset += e.size;
+  }
+  result.arena = make_unique_for_overwrite<char[]>(offset);
+
+  detail::parallel_for(count, thread_count, [&](size_t i) {
+    auto& e = result.entries[i];
+    if (e.error) return;
+    const auto path = detail::path_cstr(ranges::begin(paths)[i]);
+    try {
+      const auto file = open_file(path);
+      // Files may have shrunk in the meantime.
+      e.size = file.read_at({result.arena.get() + e.offset, e.size}, 0);
+    } catch (...) {
+      e.error = current_exception();
+    }
+  });
+
+  return result;
+}
+
+/// The 'file_writer' is the buffered counterpart to the file readers.
+/// Small writes are collected in an internal buffer
+/// and handed over to the kernel in large 'write' calls.
+/// Writes that do not fit into the buffer anymore are directly passed
+/// together with the buffered data by a single 'writev' call.
+///
+/// In the mode 'atomic_replace', all data is written to a temporary file
+/// in the same directory which only replaces the target file by 'rename'
+/// when 'close' is called successfully.
+/// Hence, readers either see the old or the new content but nothing in between.
+/// If the writer is destroyed without being closed,
+/// the temporary file is removed and the target stays untouched.
+/// In all other modes, the destructor flushes the remaining data
+/// but ignores any errors. Call 'close' to get them reported.
+///
+struct file_writer {
+  enum class mode { truncate, append, atomic_replace };
+
+  static constexpr size_t default_buffer_size = size_t{1} << 16;
+
+  explicit file_writer(czstring file_path,
+                       mode m = mode::truncate,
+                       size_t buffer_size = default_buffer_size)
+      : path{file_path},
+        write_mode{m},
+        buffer{std::make_unique_for_overwrite<char[]>(buffer_size)},
+        capacity{buffer_size} {
+    using namespace std;
+    if (write_mode == mode::atomic_replace) {
+      temp_path = path + ".tmp-XXXXXX";
+      file = file_descriptor{::mkostemp(temp_path.data(), O_CLOEXEC)};
+      if (!file) fail_to_open();
+      // Temporary files are only accessible by their owner.
+      // Take over the permissions of the file that will be replaced.
+      struct stat info;
+      const auto permissions =
+          (::stat(file_path, &info) == 0) ? (info.st_mode & 07777) : 0644;
+      ::fchmod(file.get(), permissions);
+    } else {
+      const auto flags = O_WRONLY | O_CREAT | O_CLOEXEC |
+                         ((write_mode == mode::append) ? O_APPEND : O_TRUNC);
+      file = file_descriptor{::open(file_path, flags, 0666)};
+      if (!file) fail_to_open();
+    }
+  }
+
+  file_writer(const file_writer&) = delete;
+  file_writer& operator=(const file_writer&) = delete;
+  file_writer(file_writer&&) noexcept = default;
+
+  ~file_writer() noexcept {
+    if (!file) return;
+    if (write_mode == mode::atomic_replace) {
+      file.close();
+      ::unlink(temp_path.c_str());
+      return;
+    }
+    try {
+      flush();
+    } catch (...) {
+    }
+  }
+
+  void write(std::string_view data) {
+    if (data.size() < capacity - size) {
+      std::memcpy(buffer.get() + size, data.data(), data.size());
+      size += data.size();
+      return;
+    }
+    // Large data is not copied into the buffer.
+    iovec buffers[] = {{buffer.get(), size},
+                       {const_cast<char*>(data.data()), data.size()}};
+    file.write(buffers);
+    size = 0;
+  }
+
+  void write(std::span<const std::byte> data) {
+    write(std::string_view{reinterpret_cast<czstring>(data.data()),
+                           data.size()});
+  }
+
+  void write(char c) {
+    if (size == capacity) flush();
+    if (size == capacity) return file.write({&c, 1});
+    buffer[size++] = c;
+  }
+
+  /// Scatter-gather output of multiple pieces.
+  /// If they do not fit into the buffer,
+  /// the buffer and all pieces are written by 'writev'
+  /// without copying them.
+  ///
+  void write(std::span<const std::string_view> pieces) {
+    size_t total = 0;
+    for (auto piece : pieces)
+      total += piece.size();
+    if (total < capacity - size) {
+      for (auto piece : pieces)
+        write(piece);
+      return;
+    }
+    std::vector<iovec> buffers{};
+    buffers.reserve(pieces.size() + 1);
+    buffers.push_back({buffer.get(), size});
+    for (auto piece : pieces)
+      buffers.push_back({const_cast<char*>(piece.data()), piece.size()});
+    file.write(buffers);
+    size = 0;
+  }
+
+  friend file_writer& operator<<(file_writer& writer, std::string_view data) {
+    writer.write(data);
+    return writer;
+  }
+  friend file_writer& operator<<(file_writer& writer, char c) {
+    writer.write(c);
+    return writer;
+  }
+
+  /// Hand over all buffered data to the kernel.
+  ///
+  void flush() {
+    file.write({buffer.get(), size});
+    size = 0;
+  }
+
+  /// Flush all data and close the file.
+  /// For atomic replacement, the data is synchronized to the storage device
+  /// before the temporary file is renamed to its target.
+  ///
+  void close() {
+    using namespace std;
+    flush();
+    if (write_mode == mode::atomic_replace) {
+      if (::fsync(file.get()) == -1)
+        throw runtime_error("Failed to write to the file.");
+      file.close();
+      if (::rename(temp_path.c_str(), path.c_str()) == -1) {
+        ::unlink(temp_path.c_str());
+        throw runtime_error("Failed to replace the file '" + path + "'.");
+      }
+    }
+    file.close();
+  }
+
+  [[noreturn]] void fail_to_open() const {
+    throw std::runtime_error("Failed to open the file '" + path +
+                             "' for writing.");
+  }
+
+  file_descriptor file{};
+  std::string path;
+  std::string temp_path{};
+  mode write_mode;
+  std::unique_ptr<char[]> buffer;
+  size_t capacity;
+  size_t size = 0;
+};
+
+/// Write the given bytes into a file which will be created or truncated.
+/// The data is directly written without intermediate buffering.
+///
+inline void span_to_file(std::span<const std::byte> data,
+                         czstring file_path,
+                         file_writer::mode m = file_writer::mode::truncate) {
+  file_writer file{file_path, m, 0};
+  file.write(data);
+  file.close();
+}
+
+/// Write the given string into a file which will be created or truncated.
+/// This is the counterpart to 'string_from_file'.
+///
+inline void string_to_file(std::string_view data,
+                           czstring file_path,
+                           file_writer::mode m = file_writer::mode::truncate) {
+  span_to_file(std::as_bytes(std::span{data}), file_path, m);
+}
+
 }  // namespace lyrahgames::xstd
@@ -0,0 +1,156 @@
+#pragma once
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <chrono>
+//
+#include <lyrahgames/xstd/utility.hpp>
+
+namespace lyrahgames::xstd {
+
+/// The 'latency_histogram' is a log-linear histogram in the style of HDR
+/// histograms to keep track of latency distributions including their tails.
+/// Values are stored as multiples of the given unit.
+/// Every power-of-two range of values is divided into 2^precision buckets.
+/// So, the relative error of all queries is bounded by 2^-precision
+/// and the memory is fixed for the whole range of 64-bit values.
+/// All values smaller than 2^precision are stored exactly.
+///
+/// Recording is wait-free and can be done by many threads concurrently
+/// as only relaxed atomic additions are used.
+/// Hence, the extremes are not tracked separately
+/// but derived from the lowest and highest non-empty bucket
+/// with the same relative error as all other queries.
+/// Queries may run concurrently to recording
+/// but will then only see an approximate snapshot.
+///
+template <typename unit = std::chrono::nanoseconds, size_t precision = 5>
+struct latency_histogram {
+  static_assert(precision > 0 && precision < 32,
+                "Precision must be in the range [1, 31].");
+
+  using duration = unit;
+
+  static constexpr size_t sub_buckets = size_t{1} << precision;
+  static constexpr size_t bucket_count = (64 - precision + 1) * sub_buckets;
+
+  /// Returns the index of the bucket that contains the given value.
+  ///
+  static constexpr auto bucket_index(uint64 value) noexcept -> size_t {
+    if (value < sub_buckets) return value;
+    const size_t msb = std::bit_width(value) - 1;
+    const auto mantissa = value >> (msb - precision);
+    return (msb - precision) * sub_buckets + mantissa;
+  }
+
+  /// Returns the smallest value that is stored in the given bucket.
+  ///
+  static constexpr auto bucket_lower_bound(size_t index) noexcept -> uint64 {
+    if (index < sub_buckets) return index;
+    const auto mantissa = (index % sub_buckets) + sub_buckets;
+    return uint64(mantissa) << (index / sub_buckets - 1);
+  }
+
+  /// Returns the largest value that is stored in the given bucket.
+  ///
+  static constexpr auto bucket_upper_bound(size_t index) noexcept -> uint64 {
+    if (index < sub_buckets) return index;
+    return bucket_lower_bound(index) +
+           ((uint64{1} << (index / sub_buckets - 1)) - 1);
+  }
+
+  void record(uint64 value, uint64 n = 1) noexcept {
+    using std::memory_order_relaxed;
+    buckets[bucket_index(value)].fetch_add(n, memory_order_relaxed);
+    total.fetch_add(n, memory_order_relaxed);
+    sum.fetch_add(value * n, memory_order_relaxed);
+  }
+
+  /// Record a duration of any 'std::chrono' type,
+  /// such as the result of 'xstd::duration'.
+  /// Negative durations are recorded as zero.
+  ///
+  template <typename rep, typename period>
+  void record(std::chrono::duration<rep, period> time, uint64 n = 1) noexcept {
+    const auto value = std::chrono::duration_cast<unit>(time).count();
+    record(uint64(std::max<decltype(value)>(value, 0)), n);
+  }
+
+  /// Add all recorded values of another histogram.
+  ///
+  void merge(const latency_histogram& other) noexcept {
+    using std::memory_order_relaxed;
+    for (size_t i = 0; i < bucket_count; ++i) {
+      const auto n = other.buckets[i].load(memory_order_relaxed);
+      if (n) buckets[i].fetch_add(n, memory_order_relaxed);
+    }
+    total.fetch_add(other.total.load(memory_order_relaxed),
+                    memory_order_relaxed);
+    sum.fetch_add(other.sum.load(memory_order_relaxed), memory_order_relaxed);
+  }
+
+  void reset() noexcept {
+    for (auto& b : buckets)
+      b.store(0, std::memory_order_relaxed);
+    total.store(0, std::memory_order_relaxed);
+    sum.store(0, std::memory_order_relaxed);
+  }
+
+  auto count() const noexcept -> uint64 {
+    return total.load(std::memory_order_relaxed);
+  }
+  bool empty() const noexcept { return count() == 0; }
+
+  /// Returns the lower bound of the lowest non-empty bucket.
+  ///
+  auto min() const noexcept -> unit {
+    for (size_t i = 0; i < bucket_count; ++i)
+      if (buckets[i].load(std::memory_order_relaxed))
+        return unit(bucket_lower_bound(i));
+    return unit{};
+  }
+
+  /// Returns the upper bound of the highest non-empty bucket.
+  ///
+  auto max() const noexcept -> unit {
+    for (size_t i = bucket_count; i > 0; --i)
+      if (buckets[i - 1].load(std::memory_order_relaxed))
+        return unit(bucket_upper_bound(i - 1));
+    return unit{};
+  }
+
+  // The exact mean is tracked by the sum of all values.
+  //
+  auto mean() const noexcept {
+    using result = std::chrono::duration<float64, typename unit::period>;
+    if (empty()) return result{};
+    return result(float64(sum.load(std::memory_order_relaxed)) / count());
+  }
+
+  /// Returns the value below which the given percentage
+  /// of all recorded values lies.
+  /// The percentile p has to be given in [0, 100].
+  /// The result is the upper bound of the bucket containing the percentile
+  /// and therefore does not underestimate tail latencies.
+  ///
+  auto percentile(float64 p) const noexcept -> unit {
+    const auto n = count();
+    if (n == 0) return unit{};
+    const auto rank = std::max<uint64>(
+        1, uint64(std::clamp(p, 0.0, 100.0) / 100 * n + 0.5));
+    uint64 accumulated = 0;
+    for (size_t i = 0; i < bucket_count; ++i) {
+      accumulated += buckets[i].load(std::memory_order_relaxed);
+      if (accumulated >= rank) return unit(bucket_upper_bound(i));
+    }
+    return max();
+  }
+
+  auto median() const noexcept { return percentile(50); }
+
+  std::atomic<uint64> buckets[bucket_count]{};
+  std::atomic<uint64> total{0};
+  std::atomic<uint64> sum{0};
+};
+
+}  // namespace lyrahgames::xstd
@@ -0,0 +1,238 @@
+#pragma once
+#include <atomic>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string_view>
+#include <vector>
+//
+#include <lyrahgames/xstd/chrono.hpp>
+#include <lyrahgames/xstd/static_zstring.hpp>
+#include <lyrahgames/xstd/utility.hpp>
+
+namespace lyrahgames::xstd {
+
+// This header provides always-on instrumentation by scoped profiling zones.
+// Every zone records its begin and end timestamps of the 'tsc_clock'
+// into a ring buffer owned by the current thread.
+// Hence, no locks or shared cache lines are involved on the hot path.
+// A collector regularly drains all ring buffers,
+// aggregates counts and times per zone,
+// and is able to dump the events in the Chrome trace-event format.
+
+/// A single recorded zone.
+/// The name points to the static storage of the zone name.
+///
+struct profile_event {
+  czstring name;
+  uint64 begin;
+  uint64 end;
+};
+
+/// A lock-free single-producer single-consumer ring buffer of events.
+/// The owning thread pushes events and the collector pops them.
+/// If the buffer is full, new events are dropped and counted.
+/// When the owning thread exits, the buffer is marked as retired.
+///
+struct profile_buffer {
+  static constexpr size_t capacity = size_t{1} << 14;
+  static_assert((capacity & (capacity - 1)) == 0,
+                "Capacity must be a power of two.");
+
+  explicit profile_buffer(size_t id) : thread_id{id} {}
+
+  void push(const profile_event& e) noexcept {
+    const auto t = tail.load(std::memory_order_relaxed);
+    if (t - head.load(std::memory_order_acquire) == capacity) {
+      dropped.fetch_add(1, std::memory_order_relaxed);
+      return;
+    }
+    events[t & (capacity - 1)] = e;
+    tail.store(t + 1, std::memory_order_release);
+  }
+
+  /// Move all available events to the given function.
+  ///
+  void pop_all(auto&& f) {
+    const auto h = head.load(std::memory_order_relaxed);
+    const auto t = tail.load(std::memory_order_acquire);
+    for (auto i = h; i != t; ++i)
+      f(events[i & (capacity - 1)]);
+    head.store(t, std::memory_order_release);
+  }
+
+  size_t thread_id;
+  // Producer and consumer indices are put on separate cache lines.
+  alignas(64) std::atomic<size_t> head{0};
+  alignas(64) std::atomic<size_t> tail{0};
+  std::atomic<size_t> dropped{0};
+  std::atomic<bool> retired{false};
+  profile_event events[capacity];
+};
+
+namespace detail {
+
+// All thread buffers are registered globally.
+// Buffers are shared with the registry
+// such that events of finished threads can still be collected.
+// Afterwards, the collector removes them from the registry.
+// Otherwise, short-lived threads, as in thread pools or job systems,
+// would make the registry grow without bounds.
+//
+struct profile_registry {
+  auto create() -> std::shared_ptr<profile_buffer> {
+    std::scoped_lock lock{mutex};
+    buffers.push_back(std::make_shared<profile_buffer>(next_thread_id++));
+    return buffers.back();
+  }
+
+  std::mutex mutex{};
+  std::vector<std::shared_ptr<profile_buffer>> buffers{};
+  size_t next_thread_id = 0;
+};
+
+inline profile_registry profile_buffers{};
+
+// The owner marks the buffer as retired when its thread exits.
+//
+struct profile_buffer_owner {
+  profile_buffer_owner() : buffer{profile_buffers.create()} {}
+  ~profile_buffer_owner() noexcept {
+    buffer->retired.store(true, std::memory_order_release);
+  }
+
+  profile_buffer_owner(const profile_buffer_owner&) = delete;
+  profile_buffer_owner& operator=(const profile_buffer_owner&) = delete;
+
+  std::shared_ptr<profile_buffer> buffer;
+};
+
+inline auto this_thread_profile_buffer() -> profile_buffer& {
+  thread_local const profile_buffer_owner owner{};
+  return *owner.buffer;
+}
+
+// Zone names are arbitrary static strings.
+// To get valid JSON, quotes, backslashes,
+// and control characters need to be escaped.
+//
+inline void write_json_string(std::ostream& os, czstring str) {
+  constexpr char hex[] = "0123456789abcdef";
+  os << '"';
+  for (; *str; ++str) {
+    const auto c = static_cast<unsigned char>(*str);
+    if (c == '"' || c == '\\')
+      os << '\\' << char(c);
+    else if (c < 0x20)
+      os << "\\u00" << hex[c >> 4] << hex[c & 0xf];
+    else
+      os << char(c);
+  }
+  os << '"';
+}
+
+}  // namespace detail
+
+/// RAII type to profile the scope it lives in.
+/// The name is given as template parameter
+/// such that it costs nothing at runtime.
+///
+/// void update() {
+///   profile_zone<"update"> zone{};
+///   ...
+/// }
+///
+template <static_zstring name>
+struct profile_zone {
+  profile_zone() noexcept : begin{tsc_clock::ticks()} {}
+  ~profile_zone() noexcept {
+    const auto end = tsc_clock::serialized_ticks();
+    detail::this_thread_profile_buffer().push({name.data(), begin, end});
+  }
+
+  profile_zone(const profile_zone&) = delete;
+  profile_zone& operator=(const profile_zone&) = delete;
+
+  uint64 begin;
+};
+
+/// The collector drains the ring buffers of all threads
+/// and keeps the events as well as aggregated statistics per zone.
+/// Collecting should be done regularly,
+/// for example once per frame, to prevent buffers from overflowing.
+///
+struct profile_collector {
+  struct event {
+    czstring name;
+    size_t thread_id;
+    uint64 begin;
+    uint64 end;
+  };
+
+  struct statistics {
+    size_t count = 0;
+    uint64 ticks = 0;
+
+    auto time() const { return tsc_clock::to_duration(ticks); }
+  };
+
+  /// Drain all thread buffers.
+  /// Buffers of finished threads are released afterwards.
+  /// If 'keep_events' is false, only the statistics are updated.
+  ///
+  void collect(bool keep_events = true) {
+    auto& registry = detail::profile_buffers;
+    std::scoped_lock lock{registry.mutex};
+    std::erase_if(registry.buffers, [&](const auto& buffer) {
+      // The flag needs to be read before draining.
+      // Otherwise, events pushed right before the thread exited could be lost.
+      const auto retired = buffer->retired.load(std::memory_order_acquire);
+      buffer->pop_all([&](const profile_event& e) {
+        auto& s = zones[e.name];
+        ++s.count;
+        s.ticks += e.end - e.begin;
+        if (keep_events)
+          events.push_back({e.name, buffer->thread_id, e.begin, e.end});
+      });
+      dropped += buffer->dropped.exchange(0, std::memory_order_relaxed);
+      return retired;
+    });
+  }
+
+  /// Write all kept events as Chrome trace-event JSON
+  /// which can be opened by 'chrome://tracing' or Perfetto.
+  ///
+  void write_chrome_trace(std::ostream& os) const {
+    uint64 origin = events.empty() ? 0 : events.front().begin;
+    for (const auto& e : events)
+      origin = std::min(origin, e.begin);
+    const auto us = [](uint64 ticks) {
+      using microseconds = std::chrono::duration<float64, std::micro>;
+      return microseconds(tsc_clock::to_duration(ticks)).count();
+    };
+    os << "{\"traceEvents\":[";
+    for (size_t i = 0; i < events.size(); ++i) {
+      const auto& e = events[i];
+      if (i) os << ',';
+      os << "\n{\"name\":";
+      detail::write_json_string(os, e.name);
+      os << ",\"ph\":\"X\",\"pid\":0"
+         << ",\"tid\":" << e.thread_id << ",\"ts\":" << us(e.begin - origin)
+         << ",\"dur\":" << us(e.end - e.begin) << '}';
+    }
+    os << "\n]}\n";
+  }
+
+  void clear() {
+    events.clear();
+    zones.clear();
+    dropped = 0;
+  }
+
+  std::vector<event> events{};
+  std::map<std::string_view, statistics> zones{};
+  size_t dropped = 0;
+};
+
+}  // namespace lyrahgames::xstd
@@ -0,0 +1,430 @@
+#pragma once
+#include <algorithm>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+//
+#include <lyrahgames/xstd/utility.hpp>
+
+namespace lyrahgames::xstd {
+
+/// The 'radix_tree' is the runtime counterpart of the static radix tree.
+/// It maps strings to values of the given type
+/// and is able to find the longest known prefix of a string.
+///
+/// All nodes are stored in a contiguous pool and refer to each other by index.
+/// Up to 'inline_capacity' edges are stored inside the node itself.
+/// Only nodes with more children use a separate edge list.
+/// The labels of all nodes are slices of one character arena.
+/// Splitting a node only splits its slice
+/// and does not need to copy characters.
+///
+template <typename T>
+struct radix_tree {
+  using value_type = T;
+
+  static constexpr uint32 npos = -1;
+  static constexpr size_t inline_capacity = 4;
+
+  struct node {
+    uint32 label = 0;
+    uint32 label_size = 0;
+    uint32 edge_count = 0;
+    uint32 overflow = npos;
+    char first[inline_capacity]{};
+    uint32 children[inline_capacity]{};
+  };
+
+  // Edges of nodes with many children.
+  // Like inline edges, they are sorted by their first character.
+  //
+  struct edge_list {
+    std::string first{};
+    std::vector<uint32> children{};
+  };
+
+  radix_tree() { clear(); }
+
+  auto size() const noexcept -> size_t { return size_; }
+  bool empty() const noexcept { return size_ == 0; }
+
+  void clear() {
+    nodes_.assign(1, node{});
+    values_.assign(1, std::nullopt);
+    edges_.clear();
+    free_nodes_.clear();
+    free_edges_.clear();
+    labels_.clear();
+    garbage_ = 0;
+    size_ = 0;
+  }
+
+  /// Insert the given key together with its value.
+  /// If the key is already contained, its value is not changed.
+  /// Returns a pointer to the stored value
+  /// and whether the insertion took place.
+  ///
+  auto insert(std::string_view key, T value) -> std::pair<T*, bool> {
+    uint32 index = 0;
+    size_t position = 0;
+    while (position < key.size()) {
+      const auto child = find_child(index, key[position]);
+      if (child == npos) {
+        const auto leaf = new_node(append_label(key.substr(position)));
+        add_child(index, leaf);
+        index = leaf;
+        break;
+      }
+      const auto tail = key.substr(position);
+      const auto label = label_of(child);
+      const auto common = static_cast<uint32>(
+          std::mismatch(label.begin(), label.end(), tail.begin(), tail.end())
+              .first -
+          label.begin());
+      index = (common < label.size()) ? split(index, child, common) : child;
+      position += common;
+    }
+    auto& stored = values_[index];
+    if (stored) return {&*stored, false};
+    stored.emplace(std::move(value));
+    ++size_;
+    return {&*stored, true};
+  }
+
+  /// Returns the value of the given key.
+  /// If the key is not contained, a default value is inserted.
+  ///
+  auto operator[](std::string_view key) -> T&
+  requires std::default_initializable<T> {
+    return *insert(key, T{}).first;
+  }
+
+  /// Returns a pointer to the value of the given key
+  /// or the nullptr if the key is not contained.
+  ///
+  auto find(std::string_view key) noexcept -> T* {
+    const auto index = find_node(key);
+    if (index == npos || !values_[index]) return nullptr;
+    return &*values_[index];
+  }
+  auto find(std::string_view key) const noexcept -> const T* {
+    return const_cast<radix_tree&>(*this).find(key);
+  }
+
+  bool contains(std::string_view key) const noexcept {
+    return find(key) != nullptr;
+  }
+
+  /// Remove the given key and its value.
+  /// Nodes that become superfluous are merged or released.
+  /// Returns false if the key is not contained.
+  ///
+  bool erase(std::string_view key) {
+    uint32 parent = npos;
+    uint32 index = 0;
+    size_t position = 0;
+    while (position < key.size()) {
+      const auto child = find_child(index, key[position]);
+      if (child == npos) return false;
+      const auto label = label_of(child);
+      if (key.substr(position, label.size()) != label) return false;
+      position += label.size();
+      parent = index;
+      index = child;
+    }
+    if (!values_[index]) return false;
+    values_[index].reset();
+    --size_;
+
+    if (index == 0) return true;
+    if (nodes_[index].edge_count == 0) {
+      remove_child(parent, index);
+      release(index);
+      if (parent != 0 && !values_[parent] && nodes_[parent].edge_count == 1)
+        merge(parent);
+    } else if (nodes_[index].edge_count == 1)
+      merge(index);
+
+    if (garbage_ > labels_.size() / 2) compact();
+    return true;
+  }
+
+  /// Returns the length of the longest prefix of the given string
+  /// that is contained as key together with its value.
+  /// If no such prefix exists, the nullptr is returned as value.
+  ///
+  auto longest_prefix(std::string_view str) noexcept -> std::pair<size_t, T*> {
+    std::pair<size_t, T*> result{0, nullptr};
+    if (values_[0]) result.second = &*values_[0];
+    uint32 index = 0;
+    size_t position = 0;
+    while (position < str.size()) {
+      const auto child = find_child(index, str[position]);
+      if (child == npos) break;
+      const auto label = label_of(child);
+      if (str.substr(position, label.size()) != label) break;
+      position += label.size();
+      index = child;
+      if (values_[index]) result = {position, &*values_[index]};
+    }
+    return result;
+  }
+
+  /// The visit algorithm mirrors its static counterpart.
+  /// If the whole string is a key, the function object is called
+  /// with the key and its value and true is returned.
+  ///
+  bool visit(std::string_view str, auto&& f) {
+    const auto value = find(str);
+    if (!value) return false;
+    std::forward<decltype(f)>(f)(str, *value);
+    return true;
+  }
+
+  /// The traverse algorithm mirrors its static counterpart.
+  /// The function object is called with the longest known prefix,
+  /// its value, and the tail of the given string.
+  /// Returns the length of the prefix if there is one.
+  ///
+  auto traverse(std::string_view str, auto&& f) -> std::optional<size_t> {
+    const auto [size, value] = longest_prefix(str);
+    if (!value) return {};
+    std::forward<decltype(f)>(f)(str.substr(0, size), *value,
+                                 str.substr(size));
+    return size;
+  }
+
+  /// Call the function object for all keys and values
+  /// in lexicographical order.
+  ///
+  void for_each(auto&& f) {
+    std::string key{};
+    for_each(0, key, f);
+  }
+
+  // Implementation Details
+
+  auto label_of(uint32 index) const noexcept -> std::string_view {
+    return {labels_.data() + nodes_[index].label, nodes_[index].label_size};
+  }
+
+  auto first_chars(uint32 index) const noexcept -> const char* {
+    const auto& n = nodes_[index];
+    return (n.overflow == npos) ? n.first : edges_[n.overflow].first.data();
+  }
+
+  auto child_indices(uint32 index) noexcept -> uint32* {
+    auto& n = nodes_[index];
+    return (n.overflow == npos) ? n.children
+                                : edges_[n.overflow].children.data();
+  }
+
+  auto find_child(uint32 index, char c) const noexcept -> uint32 {
+    const auto& n = nodes_[index];
+    const auto first = first_chars(index);
+    const auto match = std::char_traits<char>::find(first, n.edge_count, c);
+    if (!match) return npos;
+    const auto i = match - first;
+    return (n.overflow == npos) ? n.children[i]
+                                : edges_[n.overflow].children[i];
+  }
+
+  auto find_node(std::string_view key) const noexcept -> uint32 {
+    uint32 index = 0;
+    size_t position = 0;
+    while (position < key.size()) {
+      const auto child = find_child(index, key[position]);
+      if (child == npos) return npos;
+      const auto& n = nodes_[child];
+      // The first character has already been compared.
+      if (key.size() - position < n.label_size ||
+          std::char_traits<char>::compare(key.data() + position + 1,
+                                          labels_.data() + n.label + 1,
+                                          n.label_size - 1))
+        return npos;
+      position += n.label_size;
+      index = child;
+    }
+    return index;
+  }
+
+  auto append_label(std::string_view str) -> std::pair<uint32, uint32> {
+    const auto offset = static_cast<uint32>(labels_.size());
+    labels_.append(str);
+    return {offset, static_cast<uint32>(str.size())};
+  }
+
+  auto new_node(std::pair<uint32, uint32> label) -> uint32 {
+    uint32 index;
+    if (free_nodes_.empty()) {
+      index = static_cast<uint32>(nodes_.size());
+      nodes_.emplace_back();
+      values_.emplace_back();
+    } else {
+      index = free_nodes_.back();
+      free_nodes_.pop_back();
+    }
+    nodes_[index].label = label.first;
+    nodes_[index].label_size = label.second;
+    return index;
+  }
+
+  void release(uint32 index) {
+    auto& n = nodes_[index];
+    garbage_ += n.label_size;
+    if (n.overflow != npos) {
+      edges_[n.overflow] = {};
+      free_edges_.push_back(n.overflow);
+    }
+    n = node{};
+    values_[index].reset();
+    free_nodes_.push_back(index);
+  }
+
+  // Insert an edge while keeping all edges sorted by their first character.
+  // If the inline edges are exhausted, all edges move to an edge list.
+  //
+  void add_child(uint32 index, uint32 child) {
+    const auto c = labels_[nodes_[child].label];
+    auto& n = nodes_[index];
+    if (n.overflow == npos && n.edge_count == inline_capacity) {
+      uint32 list;
+      if (free_edges_.empty()) {
+        list = static_cast<uint32>(edges_.size());
+        edges_.emplace_back();
+      } else {
+        list = free_edges_.back();
+        free_edges_.pop_back();
+      }
+      edges_[list].first.assign(n.first, n.edge_count);
+      edges_[list].children.assign(n.children, n.children + n.edge_count);
+      n.overflow = list;
+    }
+    if (n.overflow == npos) {
+      const auto i =
+          std::upper_bound(n.first, n.first + n.edge_count, c) - n.first;
+      std::copy_backward(n.first + i, n.first + n.edge_count,
+                         n.first + n.edge_count + 1);
+      std::copy_backward(n.children + i, n.children + n.edge_count,
+                         n.children + n.edge_count + 1);
+      n.first[i] = c;
+      n.children[i] = child;
+    } else {
+      auto& list = edges_[n.overflow];
+      const auto i =
+          std::upper_bound(list.first.begin(), list.first.end(), c) -
+          list.first.begin();
+      list.first.insert(list.first.begin() + i, c);
+      list.children.insert(list.children.begin() + i, child);
+    }
+    ++n.edge_count;
+  }
+
+  void remove_child(uint32 index, uint32 child) {
+    auto& n = nodes_[index];
+    if (n.overflow == npos) {
+      const auto i = std::find(n.children, n.children + n.edge_count, child) -
+                     n.children;
+      std::copy(n.first + i + 1, n.first + n.edge_count, n.first + i);
+      std::copy(n.children + i + 1, n.children + n.edge_count,
+                n.children + i);
+    } else {
+      auto& list = edges_[n.overflow];
+      const auto i = std::find(list.children.begin(), list.children.end(),
+                               child) -
+                     list.children.begin();
+      list.first.erase(list.first.begin() + i);
+      list.children.erase(list.children.begin() + i);
+    }
+    --n.edge_count;
+  }
+
+  void replace_child(uint32 index, uint32 child, uint32 replacement) {
+    auto children = child_indices(index);
+    *std::find(children, children + nodes_[index].edge_count, child) =
+        replacement;
+  }
+
+  // Split the label of a child after the given amount of characters.
+  // The new node takes the prefix and becomes the parent of the child.
+  //
+  auto split(uint32 parent, uint32 child, uint32 size) -> uint32 {
+    const auto middle = new_node({nodes_[child].label, size});
+    nodes_[child].label += size;
+    nodes_[child].label_size -= size;
+    replace_child(parent, child, middle);
+    add_child(middle, child);
+    return middle;
+  }
+
+  // Merge a node without value with its only child.
+  // The node takes over the children and the value of the child.
+  // As labels are not adjacent in general, the joined label is appended.
+  //
+  void merge(uint32 index) {
+    const auto child = child_indices(index)[0];
+    std::string label{label_of(index)};
+    label += label_of(child);
+    garbage_ += nodes_[index].label_size;
+    const auto [offset, size] = append_label(label);
+
+    auto& n = nodes_[index];
+    auto& c = nodes_[child];
+    if (n.overflow != npos) {
+      edges_[n.overflow] = {};
+      free_edges_.push_back(n.overflow);
+    }
+    n.overflow = std::exchange(c.overflow, npos);
+    n.edge_count = std::exchange(c.edge_count, 0);
+    std::copy(c.first, c.first + inline_capacity, n.first);
+    std::copy(c.children, c.children + inline_capacity, n.children);
+    n.label = offset;
+    n.label_size = size;
+    values_[index] = std::move(values_[child]);
+    release(child);
+  }
+
+  // Labels of released and merged nodes are not removed from the arena.
+  // If they make up most of the arena, all labels are copied
+  // into a new arena in depth-first order.
+  //
+  void compact() {
+    std::string labels{};
+    labels.reserve(labels_.size() - garbage_);
+    std::vector<uint32> stack{0};
+    while (!stack.empty()) {
+      const auto index = stack.back();
+      stack.pop_back();
+      auto& n = nodes_[index];
+      const auto offset = static_cast<uint32>(labels.size());
+      labels.append(label_of(index));
+      n.label = offset;
+      const auto children = child_indices(index);
+      stack.insert(stack.end(), children, children + n.edge_count);
+    }
+    labels_ = std::move(labels);
+    garbage_ = 0;
+  }
+
+  void for_each(uint32 index, std::string& key, auto& f) {
+    const auto size = key.size();
+    key += label_of(index);
+    if (values_[index]) f(std::string_view{key}, *values_[index]);
+    for (uint32 i = 0; i < nodes_[index].edge_count; ++i)
+      for_each(child_indices(index)[i], key, f);
+    key.resize(size);
+  }
+
+  std::vector<node> nodes_{};
+  std::vector<std::optional<T>> values_{};
+  std::vector<edge_list> edges_{};
+  std::vector<uint32> free_nodes_{};
+  std::vector<uint32> free_edges_{};
+  std::string labels_{};
+  size_t garbage_ = 0;
+  size_t size_ = 0;
+};
+
+}  // namespace lyrahgames::xstd
@@ -0,0 +1,257 @@
+#pragma once
+#include <algorithm>
+#include <array>
+#include <string_view>
+//
+#include <lyrahgames/xstd/static_zstring.hpp>
+#include <lyrahgames/xstd/utility.hpp>
+
+namespace lyrahgames::xstd {
+
+namespace detail {
+
+// Sizes of the Aho-Corasick automaton for the given keys
+// that need to be known before the automaton can be constructed.
+// Bytes that do not occur in any key behave the same
+// and are therefore collected in the byte class zero.
+// The amount of states is the amount of distinct key prefixes.
+//
+template <size_t n>
+constexpr auto aho_corasick_byte_classes(
+    const std::array<std::string_view, n>& keys) {
+  std::array<uint8, 256> classes{};
+  for (auto key : keys)
+    for (auto c : key)
+      classes[static_cast<uint8>(c)] = 1;
+  size_t count = 1;
+  for (auto& c : classes)
+    if (c) c = count++;
+  return classes;
+}
+
+template <size_t n>
+constexpr auto aho_corasick_state_count(
+    std::array<std::string_view, n> keys) {
+  std::sort(keys.begin(), keys.end());
+  size_t count = 1;
+  std::string_view last{};
+  for (auto key : keys) {
+    const auto common =
+        std::mismatch(key.begin(), key.end(), last.begin(), last.end()).first -
+        key.begin();
+    count += key.size() - common;
+    last = key;
+  }
+  return count;
+}
+
+}  // namespace detail
+
+/// The 'static_aho_corasick' automaton finds all occurrences
+/// of a set of static strings anywhere inside a given text.
+/// The automaton is constructed at compile time
+/// and stored as a dense transition table over byte classes.
+/// So, every input byte costs two table lookups and a single comparison,
+/// independent of the amount of keys.
+///
+/// States are numbered such that all states with matches come last.
+/// Table entries are the row offsets of states inside the table.
+/// A match is therefore detected by comparing the current row offset.
+///
+/// using scanner = static_aho_corasick<"error", "warning", "fatal">;
+/// scanner::find_all(text, [](size_t key, size_t offset) { ... });
+///
+template <static_zstring... keys>
+struct static_aho_corasick {
+  static_assert(sizeof...(keys) > 0, "At least one key must be given.");
+  static_assert(((keys.size() > 0) && ...), "Keys must not be empty.");
+
+  static constexpr size_t npos = -1;
+  static constexpr size_t key_count = sizeof...(keys);
+  static constexpr std::array<std::string_view, key_count> strings{
+      std::string_view{keys.data(), keys.size()}...};
+
+  static constexpr auto byte_classes =
+      detail::aho_corasick_byte_classes(strings);
+  static constexpr size_t class_count =
+      *std::max_element(byte_classes.begin(), byte_classes.end()) + 1;
+  static constexpr size_t state_count =
+      detail::aho_corasick_state_count(strings);
+
+  struct automaton_type {
+    // Transitions are given as row offsets into the table.
+    std::array<uint32, state_count * class_count> transitions{};
+    // Key that ends in the given state or npos.
+    std::array<uint32, state_count> output{};
+    // Next state on the failure chain with an output or npos.
+    std::array<uint32, state_count> dictionary{};
+    // The first state that reports any match.
+    uint32 first_match = 0;
+  };
+
+  static constexpr auto construct() {
+    constexpr uint32 none = -1;
+    std::array<uint32, state_count * class_count> delta{};
+    std::array<uint32, state_count> output{};
+    std::array<uint32, state_count> fail{};
+    std::array<uint32, state_count> dictionary{};
+    for (auto& x : delta)
+      x = none;
+    for (auto& x : output)
+      x = none;
+    dictionary[0] = none;
+
+    // Build the trie of all keys.
+    // Keys that are given multiple times are reported by their first index.
+    uint32 states = 1;
+    for (size_t k = 0; k < key_count; ++k) {
+      uint32 s = 0;
+      for (auto c : strings[k]) {
+        auto& next = delta[s * class_count + byte_classes[uint8(c)]];
+        if (next == none) next = states++;
+        s = next;
+      }
+      if (output[s] == none) output[s] = k;
+    }
+
+    // Complete the transitions by the failure links in breadth-first order.
+    std::array<uint32, state_count> queue{};
+    size_t head = 0, tail = 0;
+    for (size_t c = 0; c < class_count; ++c) {
+      auto& next = delta[c];
+      if (next == none)
+        next = 0;
+      else {
+        fail[next] = 0;
+        queue[tail++] = next;
+      }
+    }
+    while (head < tail) {
+      const auto s = queue[head++];
+      const auto f = fail[s];
+      dictionary[s] = (output[f] != none) ? f : dictionary[f];
+      for (size_t c = 0; c < class_count; ++c) {
+        auto& next = delta[s * class_count + c];
+        if (next == none)
+          next = delta[f * class_count + c];
+        else {
+          fail[next] = delta[f * class_count + c];
+          queue[tail++] = next;
+        }
+      }
+    }
+
+    // Renumber the states such that all matching states come last.
+    std::array<uint32, state_count> order{};
+    uint32 index = 0;
+    for (uint32 s = 0; s < state_count; ++s)
+      if (output[s] == none && dictionary[s] == none) order[s] = index++;
+    automaton_type automaton{};
+    automaton.first_match = index * class_count;
+    for (uint32 s = 0; s < state_count; ++s)
+      if (output[s] != none || dictionary[s] != none) order[s] = index++;
+
+    for (uint32 s = 0; s < state_count; ++s) {
+      const auto row = order[s] * class_count;
+      for (size_t c = 0; c < class_count; ++c)
+        automaton.transitions[row + c] =
+            order[delta[s * class_count + c]] * class_count;
+      automaton.output[order[s]] = output[s];
+      automaton.dictionary[order[s]] =
+          (dictionary[s] == none) ? none : order[dictionary[s]];
+    }
+    return automaton;
+  }
+
+  static constexpr automaton_type automaton = construct();
+
+  /// Report all matches of the given state.
+  /// Matches are reported by key index and the offset of their first byte.
+  ///
+  static constexpr void report(uint32 row, size_t end, auto& f) {
+    auto s = row / class_count;
+    while (s != uint32(npos)) {
+      const auto key = automaton.output[s];
+      if (key != uint32(npos)) f(size_t(key), end - strings[key].size());
+      s = automaton.dictionary[s];
+    }
+  }
+
+  static constexpr size_t max_key_size =
+      std::max({size_t(keys.size())...});
+
+  /// The scanner keeps the state of the automaton between chunks.
+  /// Hence, matches that cross chunk boundaries are found as well.
+  /// Offsets are given relative to the beginning of the whole stream.
+  ///
+  /// Every byte depends on the state of the previous byte.
+  /// To not be bound by the latency of table lookups,
+  /// large chunks are split into lanes that are scanned interleaved.
+  /// The state of the automaton only depends on the last bytes
+  /// whose amount is bounded by the size of the longest key.
+  /// So, every lane but the first one starts in the root state
+  /// this amount of bytes before its beginning to get the correct state.
+  /// Matches of different lanes are therefore not reported in order.
+  ///
+  struct scanner {
+    static constexpr size_t lanes = 4;
+    static constexpr size_t min_lane_size = 4096;
+
+    constexpr void scan(std::string_view chunk, auto&& f) {
+      const auto& table = automaton.transitions;
+      const auto data = chunk.data();
+      size_t i = 0;
+      auto s = row;
+
+      if (!std::is_constant_evaluated() &&
+          chunk.size() >= lanes * (min_lane_size + max_key_size)) {
+        const auto lane_size = chunk.size() / lanes;
+        uint32 state[lanes]{s};
+        for (size_t l = 1; l < lanes; ++l)
+          for (auto j = l * lane_size - max_key_size; j < l * lane_size; ++j)
+            state[l] = table[state[l] + byte_classes[uint8(data[j])]];
+        for (size_t j = 0; j < lane_size; ++j) {
+          uint32 matching = 0;
+          for (size_t l = 0; l < lanes; ++l) {
+            const auto k = l * lane_size + j;
+            state[l] = table[state[l] + byte_classes[uint8(data[k])]];
+            matching |= (state[l] >= automaton.first_match);
+          }
+          if (matching) [[unlikely]] {
+            for (size_t l = 0; l < lanes; ++l)
+              if (state[l] >= automaton.first_match)
+                report(state[l], offset + l * lane_size + j + 1, f);
+          }
+        }
+        i = lanes * lane_size;
+        s = state[lanes - 1];
+      }
+
+      for (; i < chunk.size(); ++i) {
+        s = table[s + byte_classes[static_cast<uint8>(data[i])]];
+        if (s >= automaton.first_match) [[unlikely]]
+          report(s, offset + i + 1, f);
+      }
+      row = s;
+      offset += chunk.size();
+    }
+
+    constexpr void reset() noexcept {
+      row = 0;
+      offset = 0;
+    }
+
+    uint32 row = 0;
+    size_t offset = 0;
+  };
+
+  /// Call the function object with the key index and offset
+  /// of every occurrence of a key in the given text.
+  /// Overlapping occurrences are reported as well.
+  ///
+  static constexpr void find_all(std::string_view text, auto&& f) {
+    scanner{}.scan(text, f);
+  }
+};
+
+}  // namespace lyrahgames::xstd
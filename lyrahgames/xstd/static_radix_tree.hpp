@@ -1,6 +1,20 @@
 #pragma once
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <string_view>
+#include <type_traits>
+#if defined(__SSE2__)
+#include <immintrin.h>
+#endif
+//
 #include <lyrahgames/xstd/static_zstring.hpp>
+#include <lyrahgames/xstd/string_hash.hpp>
 #include <lyrahgames/xstd/type_list/type_list.hpp>
+#include <lyrahgames/xstd/value_list/value_list.hpp>
 
 namespace lyrahgames::xstd {
 
@@ -40,19 +54,46 @@ using node_list = type_list<nodes...>;
 
 /// Finally, the actual node template can be defined
 /// with correct and recursive constraints.
+/// Leaves may additionally carry an arbitrary payload type,
+/// such as a 'value', which is not used by the tree itself.
 template <static_zstring str,
           instance::node_list nodes = node_list<>,
-          bool leaf = false>
+          bool leaf = false,
+          typename data = void>
 struct node {
   static constexpr static_zstring string = str;
   using children = nodes;
   static constexpr bool is_leaf = leaf;
+  using payload = data;
 };
 
+/// Payload type to attach a compile-time value to a leaf.
+///
+/// using methods = map_construction<leaf<"GET", value<method::get>>,
+///                                  leaf<"PUT", value<method::put>>>;
+///
+template <auto v>
+using value = std::integral_constant<decltype(v), v>;
+
+namespace detail {
+template <static_zstring str, typename T, typename children>
+struct leaf_type {
+  using type = node<str, children, true, T>;
+};
+template <static_zstring str, instance::node_list T, typename children>
+struct leaf_type<str, T, children> {
+  using type = node<str, T, true>;
+};
+}  // namespace detail
+
 /// The leaf is an alias to the node template.
 /// It used to simplify marking nodes as leaves.
-template <static_zstring str, instance::node_list children = node_list<>>
-using leaf = node<str, children, true>;
+/// The second argument is either the list of children or a payload
+/// which is then followed by the list of children.
+template <static_zstring str,
+          typename T = node_list<>,
+          instance::node_list children = node_list<>>
+using leaf = typename detail::leaf_type<str, T, children>::type;
 
 namespace detail {
 
@@ -60,8 +101,11 @@ namespace detail {
 // we are able to implement the 'is_node' predicate.
 template <typename T>
 struct is_node : std::false_type {};
-template <static_zstring str, instance::node_list children, bool is_leaf>
-struct is_node<node<str, children, is_leaf>> : std::true_type {};
+template <static_zstring str,
+          instance::node_list children,
+          bool is_leaf,
+          typename payload>
+struct is_node<node<str, children, is_leaf, payload>> : std::true_type {};
 
 // We need to use standard type list helper functions.
 // Therefore we make the appropriate namespace available
@@ -150,7 +194,8 @@ requires(!root::string.empty())  //
 template <instance::node root, static_zstring str, size_t index>
 requires(index == root::string.size()) && (index == str.size())  //
     struct basic_insertion_implementation<root, str, index> {
-  using type = leaf<root::string, typename root::children>;
+  using type =
+      node<root::string, typename root::children, true, typename root::payload>;
 };
 
 // String Match
@@ -163,7 +208,8 @@ template <instance::node root, static_zstring str, size_t index>
 requires(index < root::string.size()) && (index == str.size())  //
     struct basic_insertion_implementation<root, str, index> {
   using split =
-      node<tail<index>(root::string), typename root::children, root::is_leaf>;
+      node<tail<index>(root::string), typename root::children, root::is_leaf,
+           typename root::payload>;
   using type = leaf<str, node_list<split>>;
 };
 
@@ -181,7 +227,8 @@ template <instance::node root, static_zstring str, size_t index>
 requires(index < root::string.size()) && (index < str.size())  //
     struct basic_insertion_implementation<root, str, index> {
   using first =
-      node<tail<index>(root::string), typename root::children, root::is_leaf>;
+      node<tail<index>(root::string), typename root::children, root::is_leaf,
+           typename root::payload>;
   using second = leaf<tail<index>(str)>;
   // If order would not be of importance, this line could be used.
   // using type = node<prefix<index>(str), node_list<first, second>>;
@@ -238,7 +285,8 @@ struct node_match_implementation {
   // using new_children = push_back<typename root::children, new_node>;
   using new_children =
       insert_when<typename root::children, new_node, node_order>;
-  using type = node<root::string, new_children, root::is_leaf>;
+  using type =
+      node<root::string, new_children, root::is_leaf, typename root::payload>;
 };
 //
 // When there is a child of the current node
@@ -256,9 +304,94 @@ struct node_match_implementation<root, str, index, true> {
   template <instance::node _>
   using inserter = basic_insertion<_, tail<index>(str)>;
   using new_children = transformation<typename root::children, inserter>;
-  using type = node<root::string, new_children, root::is_leaf>;
+  using type =
+      node<root::string, new_children, root::is_leaf, typename root::payload>;
+};
+
+}  // namespace detail
+
+/// Matching policies decide which characters of a given string
+/// are considered equal to the characters of the static strings.
+/// A policy maps both characters to a canonical one before they are compared.
+/// If several static strings are mapped to the same string,
+/// only the first one can be found.
+///
+struct case_sensitive {
+  static constexpr auto map(char c) noexcept -> char { return c; }
+};
+//
+struct ascii_case_insensitive {
+  static constexpr auto map(char c) noexcept -> char {
+    return ('A' <= c && c <= 'Z') ? char(c - 'A' + 'a') : c;
+  }
+};
+//
+/// Custom mapping of single bytes given by a constexpr function object.
+/// The mapping is evaluated once for every byte at compile time
+/// and afterwards looked up in a table.
+///
+/// using umlauts = byte_mapping<[](char c) { return (c == '-') ? '_' : c; }>;
+///
+template <auto mapping>
+struct byte_mapping {
+  static constexpr auto table = [] {
+    std::array<char, 256> result{};
+    for (size_t i = 0; i < 256; ++i)
+      result[i] = mapping(static_cast<char>(i));
+    return result;
+  }();
+  static constexpr auto map(char c) noexcept -> char {
+    return table[static_cast<uint8>(c)];
+  }
+};
+
+namespace instance {
+template <typename T>
+concept matching_policy = requires(char c) {
+  { T::map(c) } -> std::same_as<char>;
+};
+}  // namespace instance
+
+namespace detail {
+
+// Case-sensitive and ASCII case-insensitive matching
+// can both be expressed by setting bits of the input character
+// before comparing it to the expected character.
+// For letters, the case bit is set and compared to the lower-case letter.
+// Only the upper-case and lower-case letter are mapped to it.
+// As no expected character is zero, the terminator never matches.
+// This makes it possible to compare whole chunks of characters at once.
+//
+template <typename policy>
+constexpr bool maskable = meta::equal<policy, case_sensitive> ||
+                          meta::equal<policy, ascii_case_insensitive>;
+
+template <static_zstring prefix, typename policy>
+struct prefix_pattern {
+  static constexpr auto construct(bool masked) {
+    std::array<char, prefix.size() + 1> result{};
+    for (size_t i = 0; i < prefix.size(); ++i) {
+      const auto c = prefix[i];
+      const bool fold = meta::equal<policy, ascii_case_insensitive> &&
+                        (('a' <= c && c <= 'z') || ('A' <= c && c <= 'Z'));
+      result[i] = masked ? (fold ? 0x20 : 0)
+                         : (fold ? ascii_case_insensitive::map(c) : c);
+    }
+    return result;
+  }
+  static constexpr auto mask = construct(true);
+  static constexpr auto bytes = construct(false);
 };
 
+template <static_zstring prefix, typename policy>
+constexpr bool byte_equal(size_t index, char c) noexcept {
+  if constexpr (maskable<policy>) {
+    using pattern = prefix_pattern<prefix, policy>;
+    return char(c | pattern::mask[index]) == pattern::bytes[index];
+  } else
+    return c && policy::map(c) == policy::map(prefix[index]);
+}
+
 // The prefix match tries to match a static prefix
 // given as template parameter in a given dynamic string.
 // Using compiler optimization concerning the inlining of constexpr functions,
@@ -266,16 +399,387 @@ struct node_match_implementation<root, str, index, true> {
 // If no prefix match can be detected the nullptr is returned.
 // Otherwise, the tail of the given dynamic string is returned.
 //
-template <static_zstring prefix, size_t index = 0>
-constexpr auto prefix_match(czstring str) noexcept -> czstring {
+template <static_zstring prefix, typename policy, size_t index = 0>
+constexpr auto bytewise_prefix_match(czstring str) noexcept -> czstring {
   if constexpr (index == prefix.size())
     return str;
   else {
-    if (prefix[index] != *str++) return nullptr;
-    return prefix_match<prefix, index + 1>(str);
+    if (!byte_equal<prefix, policy>(index, *str++)) return nullptr;
+    return bytewise_prefix_match<prefix, policy, index + 1>(str);
+  }
+}
+
+// For long prefixes, comparing byte by byte is slow.
+// At runtime, whole chunks of the given string are therefore loaded
+// and compared to the prefix by general-purpose or vector registers.
+// The chunk width is the largest one provided by the target.
+//
+#if defined(__AVX2__)
+constexpr size_t prefix_chunk_width = 32;
+#elif defined(__SSE2__)
+constexpr size_t prefix_chunk_width = 16;
+#else
+constexpr size_t prefix_chunk_width = 8;
+#endif
+
+// For a zero-terminated string, the length is not known.
+// Loading a whole chunk may then read bytes behind the terminator.
+// This is harmless as long as the load does not cross a page boundary
+// because memory protection works on whole pages.
+// The static prefix itself contains no zero character.
+// So, a terminator inside the chunk always results in a mismatch.
+// Loads that would cross a page boundary are done byte by byte.
+// Such reads are not visible to the address sanitizer.
+//
+constexpr size_t minimal_page_size = 4096;
+
+template <size_t width>
+inline bool crosses_page(czstring str) noexcept {
+  const auto offset = reinterpret_cast<std::uintptr_t>(str) &
+                      (minimal_page_size - 1);
+  return offset > minimal_page_size - width;
+}
+
+// Compares a chunk of the given string, after setting the bits of the mask,
+// to the expected bytes.
+//
+template <size_t width, bool masked>
+#if defined(__GNUC__)
+__attribute__((no_sanitize_address))
+#endif
+inline bool chunk_equal(czstring x, czstring mask, czstring y) noexcept {
+#if defined(__AVX2__)
+  if constexpr (width == 32) {
+    auto a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(x));
+    const auto b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(y));
+    if constexpr (masked)
+      a = _mm256_or_si256(
+          a, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(mask)));
+    return _mm256_movemask_epi8(_mm256_cmpeq_epi8(a, b)) == -1;
+  }
+#endif
+#if defined(__SSE2__)
+  if constexpr (width == 16) {
+    auto a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(x));
+    const auto b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(y));
+    if constexpr (masked)
+      a = _mm_or_si128(
+          a, _mm_loadu_si128(reinterpret_cast<const __m128i*>(mask)));
+    return _mm_movemask_epi8(_mm_cmpeq_epi8(a, b)) == 0xffff;
+  }
+#endif
+  if constexpr (width <= 8) {
+    uint64 a{}, b{}, m{};
+    __builtin_memcpy(&a, x, width);
+    __builtin_memcpy(&b, y, width);
+    if constexpr (masked) __builtin_memcpy(&m, mask, width);
+    return (a | m) == b;
+  } else
+    return chunk_equal<width / 2, masked>(x, mask, y) &&
+           chunk_equal<width / 2, masked>(x + width / 2, mask + width / 2,
+                                          y + width / 2);
+}
+
+// Compares all bytes of the prefix from the given index on
+// by using decreasing chunk widths.
+// As the prefix size is known at compile time, all loops are unrolled.
+// If the length of the string is known, no page checks are needed.
+//
+template <static_zstring prefix,
+          typename policy,
+          bool bounded,
+          size_t width = prefix_chunk_width,
+          size_t index = 0>
+inline bool chunked_prefix_equal(czstring str) noexcept {
+  using pattern = prefix_pattern<prefix, policy>;
+  constexpr bool masked = !meta::equal<policy, case_sensitive>;
+  if constexpr (index == prefix.size())
+    return true;
+  else if constexpr (width == 1)
+    return byte_equal<prefix, policy>(index, str[index]) &&
+           chunked_prefix_equal<prefix, policy, bounded, 1, index + 1>(str);
+  else if constexpr (index + width > prefix.size())
+    return chunked_prefix_equal<prefix, policy, bounded, width / 2, index>(
+        str);
+  else {
+    if (bounded || !crosses_page<width>(str + index)) {
+      if (!chunk_equal<width, masked>(str + index, pattern::mask.data() + index,
+                                      pattern::bytes.data() + index))
+        return false;
+    } else {
+      for (size_t i = index; i < index + width; ++i)
+        if (!byte_equal<prefix, policy>(i, str[i])) return false;
+    }
+    return chunked_prefix_equal<prefix, policy, bounded, width, index + width>(
+        str);
+  }
+}
+
+template <static_zstring prefix,
+          instance::matching_policy policy = case_sensitive>
+constexpr auto prefix_match(czstring str, policy = {}) noexcept -> czstring {
+  if constexpr (prefix.size() < 8 || !maskable<policy>)
+    return bytewise_prefix_match<prefix, policy>(str);
+  else {
+    if (std::is_constant_evaluated())
+      return bytewise_prefix_match<prefix, policy>(str);
+    if (!chunked_prefix_equal<prefix, policy, false>(str)) return nullptr;
+    return str + prefix.size();
+  }
+}
+
+// If the length of the string is known, no terminator has to be checked.
+// Hence, a mismatch of the length can be detected before any comparison.
+// If no prefix match can be detected, nothing is returned.
+// Otherwise, the tail of the given string is returned.
+//
+template <static_zstring prefix,
+          instance::matching_policy policy = case_sensitive>
+constexpr auto prefix_match(std::string_view str, policy = {}) noexcept
+    -> std::optional<std::string_view> {
+  if (str.size() < prefix.size()) return {};
+  if (std::is_constant_evaluated() || prefix.size() < 8 || !maskable<policy>) {
+    for (size_t i = 0; i < prefix.size(); ++i)
+      if (policy::map(str[i]) != policy::map(prefix[i])) return {};
+  } else if (!chunked_prefix_equal<prefix, policy, true>(str.data()))
+    return {};
+  return str.substr(prefix.size());
+}
+
+// All children of a node start with different characters.
+// Hence, the only child that may match a given string
+// is determined by the first character of the string.
+// For nodes with many children, the child is therefore not searched
+// but dispatched by a table of function pointers
+// that is indexed by the first character.
+// Each level then only costs a single indirect call.
+// Few children are still tried sequentially
+// as these calls can be inlined and are cheaper than an indirect call.
+//
+constexpr size_t child_dispatch_threshold = 4;
+
+// Matching policies may map the first characters of different children
+// to the same character.
+// The table would then only reach one of these children.
+// Such nodes keep trying their children sequentially.
+//
+template <instance::node_list children, typename policy>
+constexpr bool dispatchable = false;
+template <typename... children, typename policy>
+constexpr bool dispatchable<node_list<children...>, policy> = [] {
+  if (sizeof...(children) <= child_dispatch_threshold) return false;
+  std::array<char, sizeof...(children)> first{
+      policy::map(children::string[0])...};
+  std::sort(first.begin(), first.end());
+  return std::adjacent_find(first.begin(), first.end()) == first.end();
+}();
+
+template <instance::node_list children, typename policy, typename functor>
+struct child_dispatch;
+template <typename... children, typename policy, typename functor>
+struct child_dispatch<node_list<children...>, policy, functor> {
+  using function = bool (*)(functor&);
+
+  template <instance::node child>
+  static constexpr bool call(functor& f) {
+    return f.template operator()<child>();
+  }
+
+  static constexpr auto table = [] {
+    std::array<function, 256> result{};
+    constexpr function functions[] = {&call<children>...};
+    constexpr char first[] = {children::string[0]...};
+    for (size_t c = 0; c < 256; ++c)
+      for (size_t i = 0; i < sizeof...(children); ++i)
+        if (policy::map(char(c)) == policy::map(first[i]))
+          result[c] = functions[i];
+    return result;
+  }();
+};
+
+template <instance::node_list children, typename policy>
+constexpr bool for_child(char c, auto& f) {
+  if constexpr (dispatchable<children, policy>) {
+    // Function pointers of the table cannot be checked
+    // in constant evaluation by all compilers.
+    if (std::is_constant_evaluated())
+      return meta::type_list::for_each_until<children>(f);
+    using functor = std::remove_reference_t<decltype(f)>;
+    using dispatch = child_dispatch<children, policy, functor>;
+    const auto call = dispatch::table[static_cast<uint8>(c)];
+    return call && call(f);
+  } else
+    return meta::type_list::for_each_until<children>(f);
+}
+
+// Inserting strings one after another instantiates the insertion templates
+// for every string and every node on its path.
+// For large sets of strings, compile time and memory are dominated by this.
+// Instead, the construction sorts all strings once by constexpr functions
+// and computes the structure of the whole tree in a single pass.
+// Afterwards, every node type is generated exactly once from this table.
+// Children are sorted by their first character as given by 'node_order'.
+// Hence, both constructions result in the same types.
+//
+template <size_t key_count, size_t char_count>
+struct sorted_tree {
+  struct node_type {
+    size_t label = 0;
+    size_t label_size = 0;
+    size_t children = 0;
+    size_t child_count = 0;
+    bool leaf = false;
+    // Position of the string of a leaf in the given keys.
+    size_t key = 0;
+  };
+  // Every key adds at most one leaf and one branching node.
+  std::array<node_type, 2 * key_count + 1> nodes{};
+  std::array<char, char_count + 1> labels{};
+  size_t node_count = 1;
+  size_t label_count = 0;
+};
+
+struct sorted_key {
+  std::string_view string;
+  size_t index;
+};
+
+// Characters are compared as 'char' to get the order of 'node_order'.
+// The plain loop is evaluated much faster by compilers
+// than the standard algorithms based on iterators.
+// Equal keys are ordered by their position
+// such that the first one is kept.
+//
+constexpr bool key_less(sorted_key x, sorted_key y) noexcept {
+  const auto size = std::min(x.string.size(), y.string.size());
+  for (size_t i = 0; i < size; ++i)
+    if (x.string[i] != y.string[i]) return x.string[i] < y.string[i];
+  if (x.string.size() != y.string.size())
+    return x.string.size() < y.string.size();
+  return x.index < y.index;
+}
+
+// All given keys are sorted, unique,
+// and share the prefix of the given depth which ends in the given node.
+// Because of the order, only the first key may end in the node.
+// All others are grouped by their next character into the children.
+// The label of a child is the longest common prefix of its group
+// which is given by the first and the last key of the group.
+//
+template <size_t n, size_t m>
+constexpr void build(sorted_tree<n, m>& tree,
+                     std::span<const sorted_key> keys,
+                     size_t index,
+                     size_t depth) {
+  if (keys.empty()) return;
+  size_t first = 0;
+  if (keys[0].string.size() == depth) {
+    tree.nodes[index].leaf = true;
+    tree.nodes[index].key = keys[0].index;
+    ++first;
   }
+  const auto group_end = [&](size_t i) {
+    const auto c = keys[i].string[depth];
+    while (i < keys.size() && keys[i].string[depth] == c)
+      ++i;
+    return i;
+  };
+  size_t count = 0;
+  for (auto i = first; i < keys.size(); i = group_end(i))
+    ++count;
+  tree.nodes[index].children = tree.node_count;
+  tree.nodes[index].child_count = count;
+  auto child = tree.node_count;
+  tree.node_count += count;
+  for (auto i = first; i < keys.size(); ++child) {
+    const auto last = group_end(i);
+    const auto x = keys[i].string;
+    const auto y = keys[last - 1].string;
+    auto end = depth + 1;
+    while (end < x.size() && end < y.size() && x[end] == y[end])
+      ++end;
+    auto& node = tree.nodes[child];
+    node.label = tree.label_count;
+    node.label_size = end - depth;
+    for (auto j = depth; j < end; ++j)
+      tree.labels[tree.label_count++] = x[j];
+    build(tree, keys.subspan(i, last - i), child, end);
+    i = last;
+  }
+}
+
+template <static_zstring... keys>
+constexpr auto sorted_tree_from() {
+  constexpr size_t char_count = (size_t{0} + ... + keys.size());
+  size_t index = 0;
+  std::array<sorted_key, sizeof...(keys)> strings{
+      sorted_key{{keys.data(), keys.size()}, index++}...};
+  std::sort(strings.begin(), strings.end(), key_less);
+  const auto end =
+      std::unique(strings.begin(), strings.end(), [](auto x, auto y) {
+        return x.string == y.string;
+      });
+  sorted_tree<sizeof...(keys), char_count> tree{};
+  build(tree, {strings.begin(), end}, 0, 0);
+  return tree;
+}
+
+template <static_zstring... keys>
+inline constexpr auto sorted_tree_of = sorted_tree_from<keys...>();
+
+// The table is given by reference such that the keys
+// are not part of the template arguments of every node.
+// Payloads of leaves are given by the position of their keys.
+// Labels are copied by a function that only depends on their size.
+// Functions or static members per node would carry all keys in their names.
+// For large key sets, this makes the back end of the compiler very slow
+// even if nothing is emitted.
+//
+template <size_t size>
+constexpr auto substring(czstring str) {
+  static_zstring<size + 1> result{};
+  for (size_t i = 0; i < size; ++i)
+    result[i] = str[i];
+  return result;
 }
 
+template <xstd::instance::type_list payloads, bool leaf, size_t key>
+struct payload_from {
+  using type = void;
+};
+template <xstd::instance::type_list payloads, size_t key>
+requires(key < payloads::size)  //
+    struct payload_from<payloads, true, key> {
+  using type = meta::type_list::element<payloads, key>;
+};
+
+template <const auto& tree,
+          size_t index,
+          xstd::instance::type_list payloads = type_list<>,
+          typename = std::make_index_sequence<tree.nodes[index].child_count>>
+struct node_from;
+template <const auto& tree,
+          size_t index,
+          xstd::instance::type_list payloads,
+          size_t... i>
+struct node_from<tree, index, payloads, std::index_sequence<i...>> {
+  using type = node<
+      substring<tree.nodes[index].label_size>(tree.labels.data() +
+                                              tree.nodes[index].label),
+      node_list<typename node_from<tree, tree.nodes[index].children + i,
+                                   payloads>::type...>,
+      tree.nodes[index].leaf,
+      typename payload_from<payloads,
+                            tree.nodes[index].leaf,
+                            tree.nodes[index].key>::type>;
+};
+
+// Only leaves without children can be used to construct a map.
+//
+template <typename T>
+concept map_entry = instance::node<T> && T::is_leaf &&
+                    (T::children::size == 0);
+
 }  // namespace detail
 
 /// Non-member type function to insert an arbitrary amount of static strings
@@ -285,8 +789,20 @@ using insertion = typename detail::insertion<root, str...>::type;
 
 /// Non-member type function to construct and initialize a static radix tree
 /// based on an arbitrary amount of static strings.
+/// The result is the same as inserting all strings into an empty tree
+/// but large sets of strings are compiled much faster.
 template <static_zstring... str>
-using construction = insertion<node<"">, str...>;
+using construction =
+    typename detail::node_from<detail::sorted_tree_of<str...>, 0>::type;
+
+/// Non-member type function to construct a static radix tree
+/// from leaves which carry payloads, such as a 'value'.
+/// If a string is given multiple times, the first payload is used.
+template <detail::map_entry... entries>
+using map_construction = typename detail::node_from<
+    detail::sorted_tree_of<entries::string...>,
+    0,
+    type_list<typename entries::payload...>>::type;
 
 /// The visit algorithm tries to match the whole string
 /// with a static string contained inside the static radix tree.
@@ -295,12 +811,14 @@ using construction = insertion<node<"">, str...>;
 /// In the other case, the algorithm returns true
 /// and calls the function object
 /// with the static string provided as template parameter.
+/// Characters are compared according to the given matching policy.
 ///
-template <instance::node root, static_zstring prefix = "">
-constexpr bool visit(czstring str, auto&& f) {
-  using namespace meta::type_list;
+template <instance::node root,
+          static_zstring prefix = "",
+          instance::matching_policy policy = case_sensitive>
+constexpr bool visit(czstring str, auto&& f, policy p = {}) {
   constexpr auto new_prefix = prefix + root::string;
-  const auto tail = detail::prefix_match<root::string>(str);
+  const auto tail = detail::prefix_match<root::string>(str, p);
   if (!tail) return false;
   if constexpr (root::is_leaf) {
     if (!*tail) {
@@ -310,8 +828,11 @@ constexpr bool visit(czstring str, auto&& f) {
   } else {
     if (!*tail) return false;
   }
-  return for_each_until<typename root::children>(
-      [&]<instance::node child> { return visit<child, new_prefix>(tail, f); });
+  auto visit_child = [&]<instance::node child> {
+    return visit<child, new_prefix>(tail, f, p);
+  };
+  return detail::for_child<typename root::children, policy>(*tail,
+                                                            visit_child);
 }
 
 /// The traverse algorithm tries to match the longest prefix
@@ -321,16 +842,18 @@ constexpr bool visit(czstring str, auto&& f) {
 /// If a prefix can be matched, the function object is called
 /// with the static prefix and the dynamic tail.
 ///
-template <instance::node root, static_zstring prefix = "">
-constexpr bool traverse(czstring str, auto&& f) {
-  using namespace meta::type_list;
-  const auto tail = detail::prefix_match<root::string>(str);
+template <instance::node root,
+          static_zstring prefix = "",
+          instance::matching_policy policy = case_sensitive>
+constexpr bool traverse(czstring str, auto&& f, policy p = {}) {
+  const auto tail = detail::prefix_match<root::string>(str, p);
   if (tail) {
     constexpr auto new_prefix = prefix + root::string;
-    const auto found =
-        for_each_until<typename root::children>([&]<instance::node child> {
-          return traverse<child, new_prefix>(tail, f);
-        });
+    auto traverse_child = [&]<instance::node child> {
+      return traverse<child, new_prefix>(tail, f, p);
+    };
+    const auto found = detail::for_child<typename root::children, policy>(
+        *tail, traverse_child);
     if constexpr (root::is_leaf) {
       if (!found)
         std::forward<decltype(f)>(f).template operator()<new_prefix>(tail);
@@ -341,6 +864,720 @@ constexpr bool traverse(czstring str, auto&& f) {
     return false;
 }
 
+namespace detail {
+
+// The size of the longest string stored in the subtree of a node
+// relative to the parent node.
+// Strings that are longer cannot be contained in the subtree.
+//
+template <instance::node root>
+struct max_string_size;
+template <static_zstring str,
+          typename... children,
+          bool is_leaf,
+          typename payload>
+struct max_string_size<node<str, node_list<children...>, is_leaf, payload>> {
+  static constexpr size_t value =
+      str.size() + std::max({size_t{0}, max_string_size<children>::value...});
+};
+
+}  // namespace detail
+
+/// Overload of the visit algorithm for strings with known length.
+/// Strings that are longer than all strings in a subtree
+/// are rejected before any characters are compared.
+/// So, tokens of a larger buffer can be looked up
+/// without copying them into zero-terminated strings.
+///
+template <instance::node root,
+          static_zstring prefix = "",
+          instance::matching_policy policy = case_sensitive>
+constexpr bool visit(std::string_view str, auto&& f, policy p = {}) {
+  if (str.size() > detail::max_string_size<root>::value) return false;
+  const auto tail = detail::prefix_match<root::string>(str, p);
+  if (!tail) return false;
+  constexpr auto new_prefix = prefix + root::string;
+  if (tail->empty()) {
+    if constexpr (root::is_leaf) {
+      std::forward<decltype(f)>(f).template operator()<new_prefix>();
+      return true;
+    } else
+      return false;
+  }
+  auto visit_child = [&]<instance::node child> {
+    return visit<child, new_prefix>(*tail, f, p);
+  };
+  return detail::for_child<typename root::children, policy>(tail->front(),
+                                                            visit_child);
+}
+
+/// Overload of the traverse algorithm for strings with known length.
+/// The function object is called with the static prefix
+/// and the tail as 'std::string_view'.
+/// Instead of a boolean, the length of the matched prefix is returned
+/// such that tokenizers are able to advance without scanning again.
+/// If no prefix can be matched, nothing is returned.
+///
+template <instance::node root,
+          static_zstring prefix = "",
+          instance::matching_policy policy = case_sensitive>
+constexpr auto traverse(std::string_view str, auto&& f, policy p = {})
+    -> std::optional<size_t> {
+  const auto tail = detail::prefix_match<root::string>(str, p);
+  if (!tail) return {};
+  constexpr auto new_prefix = prefix + root::string;
+  std::optional<size_t> size{};
+  auto traverse_child = [&]<instance::node child> {
+    size = traverse<child, new_prefix>(*tail, f, p);
+    return size.has_value();
+  };
+  if (!tail->empty())
+    detail::for_child<typename root::children, policy>(tail->front(),
+                                                       traverse_child);
+  if (size) return root::string.size() + *size;
+  if constexpr (root::is_leaf) {
+    std::forward<decltype(f)>(f).template operator()<new_prefix>(*tail);
+    return root::string.size();
+  } else
+    return {};
+}
+
+namespace detail {
+
+// To get access to all strings stored inside a static radix tree,
+// the leaves are collected into a value list of static strings.
+// Its order is given by a depth-first traversal
+// which visits the leaf of a node before its children.
+// Concatenating value lists for every node is superlinear at compile time.
+// Instead, the strings of all leaves are written once
+// into a constexpr table by a single traversal
+// and every static string is then generated from this table.
+//
+template <size_t leaf_count, size_t char_count>
+struct leaf_table {
+  constexpr auto size(size_t index) const noexcept {
+    return offsets[index + 1] - offsets[index];
+  }
+
+  std::array<size_t, leaf_count + 1> offsets{};
+  std::array<char, char_count + 1> chars{};
+};
+
+struct leaf_table_size {
+  size_t leaves = 0;
+  size_t chars = 0;
+  size_t depth = 0;
+};
+
+template <instance::node root>
+constexpr void count_leaves(leaf_table_size& sizes, size_t depth) {
+  depth += root::string.size();
+  sizes.depth = std::max(sizes.depth, depth);
+  if constexpr (root::is_leaf) {
+    ++sizes.leaves;
+    sizes.chars += depth;
+  }
+  meta::type_list::for_each<typename root::children>(
+      [&]<instance::node child> { count_leaves<child>(sizes, depth); });
+}
+
+// The path buffer holds the string of the current node.
+//
+template <instance::node root>
+constexpr void collect_leaves(auto& table,
+                              auto& path,
+                              size_t depth,
+                              size_t& leaf) {
+  for (size_t i = 0; i < root::string.size(); ++i)
+    path[depth++] = root::string[i];
+  if constexpr (root::is_leaf) {
+    const auto offset = table.offsets[leaf];
+    for (size_t i = 0; i < depth; ++i)
+      table.chars[offset + i] = path[i];
+    table.offsets[++leaf] = offset + depth;
+  }
+  meta::type_list::for_each<typename root::children>(
+      [&]<instance::node child> { collect_leaves<child>(table, path, depth, leaf); });
+}
+
+template <instance::node root>
+constexpr auto leaf_table_from() {
+  constexpr auto sizes = [] {
+    leaf_table_size result{};
+    count_leaves<root>(result, 0);
+    return result;
+  }();
+  leaf_table<sizes.leaves, sizes.chars> table{};
+  std::array<char, sizes.depth + 1> path{};
+  size_t leaf = 0;
+  collect_leaves<root>(table, path, 0, leaf);
+  return table;
+}
+
+template <instance::node root>
+inline constexpr auto leaf_table_of = leaf_table_from<root>();
+
+// Views to the strings of all leaves.
+// They can be used without instantiating a static string per leaf.
+//
+template <instance::node root>
+inline constexpr auto leaf_strings = [] {
+  constexpr auto& table = leaf_table_of<root>;
+  std::array<std::string_view, table.offsets.size() - 1> result{};
+  for (size_t i = 0; i < result.size(); ++i)
+    result[i] = {table.chars.data() + table.offsets[i], table.size(i)};
+  return result;
+}();
+
+// The static strings are copied by 'substring'
+// to not instantiate a function for every leaf.
+//
+template <const auto& table, size_t index>
+constexpr auto leaf_string =
+    substring<table.size(index)>(table.chars.data() + table.offsets[index]);
+
+template <instance::node root,
+          typename = std::make_index_sequence<leaf_strings<root>.size()>>
+struct leaf_list;
+template <instance::node root, size_t... i>
+struct leaf_list<root, std::index_sequence<i...>> {
+  using type = value_list<leaf_string<leaf_table_of<root>, i>...>;
+};
+
+}  // namespace detail
+
+/// Value list of all static strings stored inside the given static radix tree.
+/// The position of a string inside this list is called its leaf index.
+///
+template <instance::node root>
+using leaves = typename detail::leaf_list<root>::type;
+
+/// The amount of strings stored inside the given static radix tree.
+///
+template <instance::node root>
+constexpr size_t leaf_count = detail::leaf_strings<root>.size();
+
+namespace detail {
+
+// The perfect hash uses a string hash
+// which can be evaluated at compile time and at runtime.
+// Afterwards, the hash value is displaced
+// by a bucket-specific seed and remixed.
+//
+constexpr auto string_hash(std::string_view str) noexcept -> uint64 {
+  return wyhash(str);
+}
+//
+constexpr auto remix(uint64 hash, uint64 seed) noexcept -> uint64 {
+  auto x = hash + seed * 0x9e3779b97f4a7c15ull;
+  x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ull;
+  x = (x ^ (x >> 27)) * 0x94d049bb133111ebull;
+  return x ^ (x >> 31);
+}
+
+// Construction of a minimal-overhead perfect hash table
+// by the CHD algorithm (compress, hash, and displace).
+// All keys are distributed into buckets by their hash.
+// Beginning with the largest bucket,
+// a displacement seed is searched for every bucket
+// such that all its keys are mapped to free slots of the table.
+// A lookup then needs to compute one string hash,
+// a cheap remix, and one verifying string comparison.
+//
+// The keys are given by reference to an array of string views
+// such that they are not part of the template arguments.
+//
+template <const auto& keys>
+struct perfect_hash {
+  static constexpr auto& strings = keys;
+  static constexpr size_t size = strings.size();
+  static constexpr size_t table_size = std::bit_ceil(size + size / 2 + 1);
+  static constexpr size_t bucket_count = std::bit_ceil(size / 2 + 1);
+  static constexpr uint32 empty_slot = ~uint32{0};
+
+  struct table_type {
+    std::array<uint32, bucket_count> displacements{};
+    std::array<uint32, table_size> slots{};
+    bool valid = true;
+  };
+
+  static constexpr auto construct() {
+    table_type table{};
+    for (auto& slot : table.slots)
+      slot = empty_slot;
+
+    // The keys are grouped by their bucket once by a counting sort
+    // such that placing a bucket only needs to look at its own keys.
+    std::array<uint64, size> hashes{};
+    std::array<size_t, bucket_count + 1> bucket_begin{};
+    for (size_t i = 0; i < size; ++i) {
+      hashes[i] = string_hash(strings[i]);
+      ++bucket_begin[(hashes[i] & (bucket_count - 1)) + 1];
+    }
+    for (size_t i = 0; i < bucket_count; ++i)
+      bucket_begin[i + 1] += bucket_begin[i];
+    std::array<size_t, size> members{};
+    auto bucket_end = bucket_begin;
+    for (size_t i = 0; i < size; ++i)
+      members[bucket_end[hashes[i] & (bucket_count - 1)]++] = i;
+    const auto bucket_size = [&](size_t bucket) {
+      return bucket_begin[bucket + 1] - bucket_begin[bucket];
+    };
+
+    // Handle larger buckets first as they are harder to place.
+    std::array<size_t, bucket_count> order{};
+    for (size_t i = 0; i < bucket_count; ++i)
+      order[i] = i;
+    std::sort(order.begin(), order.end(), [&](size_t i, size_t j) {
+      return bucket_size(i) > bucket_size(j);
+    });
+
+    std::array<size_t, size> used{};
+    for (auto bucket : order) {
+      if (bucket_size(bucket) == 0) break;
+      const auto first = bucket_begin[bucket];
+      const auto last = bucket_begin[bucket + 1];
+      bool placed = false;
+      for (uint32 seed = 0; !placed && seed < (1u << 16); ++seed) {
+        size_t count = 0;
+        placed = true;
+        for (auto i = first; placed && i < last; ++i) {
+          const auto slot =
+              remix(hashes[members[i]], seed) & (table_size - 1);
+          if (table.slots[slot] != empty_slot) placed = false;
+          for (size_t j = 0; j < count; ++j)
+            if (used[j] == slot) placed = false;
+          used[count++] = slot;
+        }
+        if (!placed) continue;
+        table.displacements[bucket] = seed;
+        for (auto i = first; i < last; ++i)
+          table.slots[used[i - first]] = members[i];
+      }
+      if (!placed) table.valid = false;
+    }
+    return table;
+  }
+
+  static constexpr table_type table = construct();
+  static_assert(table.valid, "Failed to construct perfect hash table.");
+
+  /// Returns the index of the given string in the key list
+  /// or the size of the key list if the string is not a key.
+  ///
+  static constexpr auto find(std::string_view str) noexcept -> size_t {
+    const auto hash = string_hash(str);
+    const auto seed = table.displacements[hash & (bucket_count - 1)];
+    const auto index = table.slots[remix(hash, seed) & (table_size - 1)];
+    if (index == empty_slot || strings[index] != str) return size;
+    return index;
+  }
+
+  /// Write the indices of all given strings to the given output.
+  /// Strings that are no keys get the given index for missing keys.
+  /// The strings are processed in groups.
+  /// At first, the candidates of all strings in a group are computed.
+  /// These computations are independent and overlap inside the processor.
+  /// Afterwards, all candidates are verified.
+  /// The characters of the next group are prefetched in the meantime.
+  ///
+  static void find_all(std::span<const std::string_view> strs,
+                       std::span<size_t> indices,
+                       size_t missing = size) noexcept {
+    assert(indices.size() >= strs.size());
+    constexpr size_t group = 16;
+    uint32 candidates[group];
+    for (size_t i = 0; i < strs.size(); i += group) {
+      const auto n = std::min(group, strs.size() - i);
+      for (size_t j = 0; j < n; ++j) {
+        if (i + j + group < strs.size())
+          __builtin_prefetch(strs[i + j + group].data());
+        const auto hash = string_hash(strs[i + j]);
+        const auto seed = table.displacements[hash & (bucket_count - 1)];
+        candidates[j] = table.slots[remix(hash, seed) & (table_size - 1)];
+      }
+      for (size_t j = 0; j < n; ++j) {
+        const auto index = candidates[j];
+        indices[i + j] =
+            (index != empty_slot && strings[index] == strs[i + j]) ? index
+                                                                   : missing;
+      }
+    }
+  }
+};
+
+template <instance::node root>
+using leaf_hash = perfect_hash<leaf_strings<root>>;
+
+// Call the function object with the static string of the given leaf index.
+// The fold expression is typically compiled to a jump table.
+// The static strings are taken from the leaf table
+// such that the value list of all leaves is not instantiated.
+//
+template <instance::node root, size_t... i>
+constexpr bool dispatch(std::index_sequence<i...>, size_t index, auto&& f) {
+  constexpr auto& table = leaf_table_of<root>;
+  return ((index == i && (std::forward<decltype(f)>(f)
+                              .template operator()<leaf_string<table, i>>(),
+                          true)) ||
+          ...);
+}
+
+}  // namespace detail
+
+/// The hash visit algorithm has the same semantics as the visit algorithm.
+/// But instead of walking through the tree character by character,
+/// it uses a perfect hash table over all strings of the tree
+/// generated at compile time.
+/// So, every lookup needs exactly one hash computation over the given string
+/// and one verifying comparison, independent of the amount of strings.
+///
+template <instance::node root>
+constexpr bool hash_visit(std::string_view str, auto&& f) {
+  using hash = detail::leaf_hash<root>;
+  const auto index = hash::find(str);
+  if (index == hash::size) return false;
+  return detail::dispatch<root>(std::make_index_sequence<hash::size>{}, index,
+                                std::forward<decltype(f)>(f));
+}
+
+/// Index that is returned if a string is not contained in a tree.
+///
+inline constexpr size_t npos = -1;
+
+namespace detail {
+
+// Nodes of a flat tree with more children than this
+// get a table that maps every character to the matching child.
+// Fewer children are scanned linearly which is faster for them
+// and saves the memory of the table.
+//
+constexpr size_t flat_dispatch_threshold = 8;
+
+}  // namespace detail
+
+/// A flat radix tree stores all nodes of a static radix tree
+/// in contiguous arrays such that it can be put into read-only memory.
+/// The children of a node are stored consecutively
+/// and their first characters are kept in a separate array
+/// to quickly scan for the next node.
+/// Nodes with many children instead find the next node
+/// by a table indexed by the next character.
+/// Leaves are identified by their leaf index.
+/// So, all lookups are done by a single loop
+/// without any code that depends on the contained strings.
+///
+template <size_t node_count, size_t label_count, size_t dispatch_count = 0>
+struct flat_tree {
+  static constexpr size_t npos = static_radix_tree::npos;
+  static constexpr uint32 no_leaf = -1;
+  static constexpr uint32 no_dispatch = -1;
+
+  struct node_type {
+    uint32 label;
+    uint32 label_size;
+    uint32 children;
+    uint32 child_count;
+    uint32 leaf;
+    uint32 dispatch;
+  };
+
+  // Dispatch tables store the position of the matching child
+  // inside the block of children plus one.
+  // So, zero marks characters without a matching child.
+  // Hence, dispatched nodes may have at most 255 children.
+  //
+  using dispatch_type = std::array<uint8, 256>;
+
+  // Labels are short on average and their lengths vary from node to node.
+  // A loop over their bytes therefore mispredicts its exit on every level.
+  // Instead, chunks of eight bytes are loaded and compared at once
+  // and the bytes behind the label are masked out.
+  // The labels are padded such that these loads stay inside the array.
+  // For the given string, the same page rules as for 'prefix_match' apply.
+  //
+#if defined(__GNUC__)
+  __attribute__((no_sanitize_address))
+#endif
+  static constexpr bool
+  equal(const char* x, const char* y, size_t size) noexcept {
+    if (std::is_constant_evaluated() ||
+        std::endian::native != std::endian::little) {
+      for (size_t i = 0; i < size; ++i)
+        if (x[i] != y[i]) return false;
+      return true;
+    }
+    uint64 a, b;
+    for (; size >= 8; size -= 8, x += 8, y += 8) {
+      __builtin_memcpy(&a, x, 8);
+      __builtin_memcpy(&b, y, 8);
+      if (a != b) return false;
+    }
+    if (!size) return true;
+    if (detail::crosses_page<8>(x)) {
+      for (size_t i = 0; i < size; ++i)
+        if (x[i] != y[i]) return false;
+      return true;
+    }
+    __builtin_memcpy(&a, x, 8);
+    __builtin_memcpy(&b, y, 8);
+    return !((a ^ b) & (~uint64{0} >> (64 - 8 * size)));
+  }
+
+  // Returns the position of the child with the given first character
+  // inside the block of children or the amount of children if there is none.
+  // The first characters of at most eight children
+  // are compared at once without any branches.
+  // The array of first characters is padded to allow the load.
+  //
+  constexpr auto find_first(uint32 children, uint32 count, char c)
+      const noexcept -> uint32 {
+    if (std::is_constant_evaluated() || count > 8 ||
+        std::endian::native != std::endian::little) {
+      uint32 i = 0;
+      while (i < count && first[children + i] != c)
+        ++i;
+      return i;
+    }
+    constexpr uint64 ones = 0x0101010101010101ull;
+    uint64 x;
+    __builtin_memcpy(&x, &first[children], sizeof(x));
+    x ^= ones * static_cast<uint8>(c);
+    // Only bytes behind the first zero byte may be wrongly marked.
+    const auto zeros = (x - ones) & ~x & (ones << 7);
+    const auto i = zeros ? uint32(std::countr_zero(zeros) / 8) : uint32{8};
+    return std::min(i, count);
+  }
+
+  /// Returns the leaf index of the given string
+  /// or 'npos' if the string is not contained.
+  ///
+  constexpr auto find(std::string_view str) const noexcept -> size_t {
+    const auto& root = nodes[0];
+    if (str.size() < root.label_size ||
+        !equal(str.data(), &labels[root.label], root.label_size))
+      return npos;
+    size_t position = root.label_size;
+    uint32 index = 0;
+    while (position < str.size()) {
+      const auto& node = nodes[index];
+      const auto c = str[position];
+      uint32 child = node.children;
+      if (node.dispatch != no_dispatch) {
+        const auto offset = dispatches[node.dispatch][static_cast<uint8>(c)];
+        if (!offset) return npos;
+        child += offset - 1;
+      } else {
+        const auto offset = find_first(child, node.child_count, c);
+        if (offset == node.child_count) return npos;
+        child += offset;
+      }
+      // The first character has already been compared.
+      const auto& next = nodes[child];
+      if (str.size() - position < next.label_size ||
+          !equal(str.data() + position + 1, &labels[next.label + 1],
+                 next.label_size - 1))
+        return npos;
+      position += next.label_size;
+      index = child;
+    }
+    const auto leaf = nodes[index].leaf;
+    return (leaf == no_leaf) ? npos : leaf;
+  }
+
+  std::array<node_type, node_count> nodes{};
+  std::array<char, node_count + 8> first{};
+  std::array<char, label_count> labels{};
+  std::array<dispatch_type, dispatch_count> dispatches{};
+};
+
+namespace detail {
+
+// The children of a node start with different characters.
+// So, all nodes with enough children can be dispatched
+// as long as their positions fit into the entries of the table.
+//
+template <size_t count>
+constexpr bool flat_dispatched =
+    (count > flat_dispatch_threshold) && (count < 256);
+
+// Sizes of the flat representation of a static radix tree.
+//
+template <instance::node root>
+struct flat_size;
+template <static_zstring str,
+          typename... children,
+          bool is_leaf,
+          typename payload>
+struct flat_size<node<str, node_list<children...>, is_leaf, payload>> {
+  static constexpr size_t nodes = (1 + ... + flat_size<children>::nodes);
+  static constexpr size_t labels =
+      (str.size() + ... + flat_size<children>::labels);
+  static constexpr size_t dispatches =
+      (size_t{flat_dispatched<sizeof...(children)>} + ... +
+       flat_size<children>::dispatches);
+};
+
+// The flattening writes the given node at the given index
+// and reserves a consecutive block of nodes for its children.
+// Afterwards, all children are recursively written into the block.
+// As a node is handled before its children,
+// the leaf indices equal the positions in the list of leaves.
+//
+template <instance::node root>
+constexpr void flatten(auto& tree,
+                       uint32 index,
+                       uint32& next_node,
+                       uint32& next_label,
+                       uint32& next_leaf,
+                       uint32& next_dispatch) {
+  using namespace meta::type_list;
+  using children = typename root::children;
+  auto& node = tree.nodes[index];
+  node.label = next_label;
+  node.label_size = root::string.size();
+  for (size_t i = 0; i < root::string.size(); ++i)
+    tree.labels[next_label++] = root::string[i];
+  tree.first[index] = root::string.empty() ? '\0' : root::string[0];
+  node.leaf = root::is_leaf ? next_leaf++ : tree.no_leaf;
+  node.children = next_node;
+  node.child_count = children::size;
+  node.dispatch = tree.no_dispatch;
+  if constexpr (flat_dispatched<children::size>) {
+    node.dispatch = next_dispatch++;
+    auto& dispatch = tree.dispatches[node.dispatch];
+    uint8 offset = 0;
+    for_each<children>([&]<instance::node child> {
+      dispatch[static_cast<uint8>(child::string[0])] = ++offset;
+    });
+  }
+  next_node += children::size;
+  auto child_index = node.children;
+  for_each<children>([&]<instance::node child> {
+    flatten<child>(tree, child_index++, next_node, next_label, next_leaf,
+                   next_dispatch);
+  });
+}
+
+template <instance::node root>
+constexpr auto flat_tree_from() {
+  using sizes = flat_size<root>;
+  // Labels are padded to allow chunked loads behind the last label.
+  flat_tree<sizes::nodes, sizes::labels + 8, sizes::dispatches> tree{};
+  uint32 next_node = 1;
+  uint32 next_label = 0;
+  uint32 next_leaf = 0;
+  uint32 next_dispatch = 0;
+  flatten<root>(tree, 0, next_node, next_label, next_leaf, next_dispatch);
+  return tree;
+}
+
+}  // namespace detail
+
+/// The flat tree of a static radix tree generated at compile time.
+/// Its leaf indices are the positions of the strings in 'leaves<root>'.
+///
+/// using tree = construction<"help", "version">;
+/// const auto index = flattening<tree>.find("version");  // == 1
+///
+template <instance::node root>
+inline constexpr auto flattening = detail::flat_tree_from<root>();
+
+/// Batch version of the visit algorithm.
+/// For every given string, the leaf index of the static string it equals,
+/// or 'npos' if there is none, is written to the given output.
+/// Lookups are done by the perfect hash table of the tree
+/// and interleaved in groups to increase the throughput.
+///
+template <instance::node root>
+inline void visit_all(std::span<const std::string_view> strs,
+                      std::span<size_t> indices) noexcept {
+  detail::leaf_hash<root>::find_all(strs, indices, npos);
+}
+
+namespace detail {
+
+// The payloads of all leaves in the order of their leaf indices.
+//
+template <instance::node root>
+struct payload_list;
+//
+template <instance::node_list nodes>
+struct children_payload_list;
+template <>
+struct children_payload_list<node_list<>> {
+  using type = type_list<>;
+};
+template <typename child, typename... children>
+struct children_payload_list<node_list<child, children...>> {
+  using type = meta::type_list::concatenation<
+      typename payload_list<child>::type,
+      typename children_payload_list<node_list<children...>>::type>;
+};
+//
+template <instance::node root>
+struct payload_list {
+  using self = std::conditional_t<root::is_leaf,
+                                  type_list<typename root::payload>,
+                                  type_list<>>;
+  using type = meta::type_list::concatenation<
+      self,
+      typename children_payload_list<typename root::children>::type>;
+};
+
+}  // namespace detail
+
+/// Type list of the payloads of all leaves ordered by their leaf index.
+///
+template <instance::node root>
+using payloads = typename detail::payload_list<root>::type;
+
+/// Returns the leaf index of the given string
+/// or 'npos' if the string is not contained in the tree.
+/// The lookup is a single loop over the flat tree
+/// and does not instantiate any code per contained string.
+///
+template <instance::node root>
+constexpr auto leaf_index(std::string_view str) noexcept -> size_t {
+  return flattening<root>.find(str);
+}
+
+namespace detail {
+
+template <xstd::instance::type_list list>
+struct payload_values;
+template <typename... payload>
+struct payload_values<type_list<payload...>> {
+  using value_type = std::common_type_t<typename payload::value_type...>;
+  static constexpr std::array<value_type, sizeof...(payload)> values{
+      payload::value...};
+};
+
+}  // namespace detail
+
+/// The common type of all values stored as payloads inside the tree.
+///
+template <instance::node root>
+using value_type = typename detail::payload_values<payloads<root>>::value_type;
+
+/// Returns the value stored as payload in the leaf of the given string.
+/// So, mapping strings to enumerations or other constants
+/// needs a single pass over the string and a table lookup.
+/// All leaves of the tree need to carry a 'value' as payload.
+///
+/// using methods = map_construction<leaf<"GET", value<method::get>>,
+///                                  leaf<"PUT", value<method::put>>>;
+/// const auto m = find<methods>("PUT");  // == method::put
+///
+template <instance::node root>
+constexpr auto find(std::string_view str) noexcept
+    -> std::optional<value_type<root>> {
+  using values = detail::payload_values<payloads<root>>;
+  const auto index = leaf_index<root>(str);
+  if (index == npos) return {};
+  return values::values[index];
+}
+
 }  // namespace static_radix_tree
 
 }  // namespace lyrahgames::xstd
@@ -0,0 +1,356 @@
+#pragma once
+#include <array>
+#include <bit>
+#include <cstring>
+#include <string_view>
+#include <type_traits>
+//
+#include <lyrahgames/xstd/static_zstring.hpp>
+#include <lyrahgames/xstd/utility.hpp>
+
+namespace lyrahgames::xstd {
+
+// This header provides string hash functions
+// that can be evaluated at compile time and at runtime.
+// For the same bytes, both evaluations result in the same value.
+// So, hashes of static strings can be used as constants
+// and compared to hashes of strings that are only known at runtime.
+// Bytes are always read in little-endian order.
+
+namespace detail {
+
+constexpr auto read_le64(czstring p) noexcept -> uint64 {
+  if (!std::is_constant_evaluated() &&
+      std::endian::native == std::endian::little) {
+    uint64 result;
+    std::memcpy(&result, p, sizeof(result));
+    return result;
+  }
+  uint64 result = 0;
+  for (size_t i = 0; i < 8; ++i)
+    result |= uint64(static_cast<uint8>(p[i])) << (8 * i);
+  return result;
+}
+
+constexpr auto read_le32(czstring p) noexcept -> uint64 {
+  if (!std::is_constant_evaluated() &&
+      std::endian::native == std::endian::little) {
+    uint32 result;
+    std::memcpy(&result, p, sizeof(result));
+    return result;
+  }
+  uint64 result = 0;
+  for (size_t i = 0; i < 4; ++i)
+    result |= uint64(static_cast<uint8>(p[i])) << (8 * i);
+  return result;
+}
+
+// 'std::byteswap' is only available since C++23.
+//
+constexpr auto byteswap(uint64 x) noexcept -> uint64 {
+  x = ((x & 0x00ff00ff00ff00ffull) << 8) | ((x >> 8) & 0x00ff00ff00ff00ffull);
+  x = ((x & 0x0000ffff0000ffffull) << 16) | ((x >> 16) & 0x0000ffff0000ffffull);
+  return (x << 32) | (x >> 32);
+}
+
+constexpr auto byteswap(uint32 x) noexcept -> uint32 {
+  x = ((x & 0x00ff00ffu) << 8) | ((x >> 8) & 0x00ff00ffu);
+  return (x << 16) | (x >> 16);
+}
+
+// Full 64-bit times 64-bit multiplication
+// whose low and high part are returned in the given arguments.
+//
+constexpr void multiply(uint64& a, uint64& b) noexcept {
+#if defined(__SIZEOF_INT128__)
+  const auto r = static_cast<unsigned __int128>(a) * b;
+  a = static_cast<uint64>(r);
+  b = static_cast<uint64>(r >> 64);
+#else
+  const uint64 ha = a >> 32, hb = b >> 32, la = uint32(a), lb = uint32(b);
+  const uint64 rh = ha * hb, rm0 = ha * lb, rm1 = hb * la, rl = la * lb;
+  const uint64 t = rl + (rm0 << 32);
+  const uint64 lo = t + (rm1 << 32);
+  const uint64 hi = rh + (rm0 >> 32) + (rm1 >> 32) + (t < rl) + (lo < t);
+  a = lo;
+  b = hi;
+#endif
+}
+
+constexpr auto multiply_fold(uint64 a, uint64 b) noexcept -> uint64 {
+  multiply(a, b);
+  return a ^ b;
+}
+
+}  // namespace detail
+
+/// 64-bit FNV-1a hash.
+/// It is the cheapest hash for short strings
+/// but processes only a single byte per step.
+///
+constexpr auto fnv1a(std::string_view str) noexcept -> uint64 {
+  uint64 hash = 0xcbf29ce484222325ull;
+  for (auto c : str) {
+    hash ^= static_cast<uint8>(c);
+    hash *= 0x100000001b3ull;
+  }
+  return hash;
+}
+
+/// The final version 4 of wyhash by Wang Yi with its default secret.
+///
+constexpr auto wyhash(std::string_view str, uint64 seed = 0) noexcept
+    -> uint64 {
+  using detail::multiply;
+  using detail::multiply_fold;
+  using detail::read_le32;
+  using detail::read_le64;
+  constexpr uint64 secret[] = {0xa0761d6478bd642full, 0xe7037ed1a0b428dbull,
+                               0x8ebc6af09c88c6e3ull, 0x589965cc75374cc3ull};
+  auto p = str.data();
+  const auto size = str.size();
+  seed ^= multiply_fold(seed ^ secret[0], secret[1]);
+  uint64 a = 0, b = 0;
+  if (size <= 16) {
+    if (size >= 4) {
+      const auto offset = (size >> 3) << 2;
+      a = (read_le32(p) << 32) | read_le32(p + offset);
+      b = (read_le32(p + size - 4) << 32) | read_le32(p + size - 4 - offset);
+    } else if (size > 0) {
+      a = (uint64(static_cast<uint8>(p[0])) << 16) |
+          (uint64(static_cast<uint8>(p[size >> 1])) << 8) |
+          uint64(static_cast<uint8>(p[size - 1]));
+    }
+  } else {
+    auto i = size;
+    if (i > 48) {
+      auto seed1 = seed, seed2 = seed;
+      do {
+        seed = multiply_fold(read_le64(p) ^ secret[1], read_le64(p + 8) ^ seed);
+        seed1 = multiply_fold(read_le64(p + 16) ^ secret[2],
+                              read_le64(p + 24) ^ seed1);
+        seed2 = multiply_fold(read_le64(p + 32) ^ secret[3],
+                              read_le64(p + 40) ^ seed2);
+        p += 48;
+        i -= 48;
+      } while (i > 48);
+      seed ^= seed1 ^ seed2;
+    }
+    while (i > 16) {
+      seed = multiply_fold(read_le64(p) ^ secret[1], read_le64(p + 8) ^ seed);
+      i -= 16;
+      p += 16;
+    }
+    a = read_le64(p + i - 16);
+    b = read_le64(p + i - 8);
+  }
+  a ^= secret[1];
+  b ^= seed;
+  multiply(a, b);
+  return multiply_fold(a ^ secret[0] ^ size, b ^ secret[1]);
+}
+
+namespace detail {
+
+struct xxh3 {
+  static constexpr uint64 prime32_1 = 0x9e3779b1u;
+  static constexpr uint64 prime32_2 = 0x85ebca77u;
+  static constexpr uint64 prime32_3 = 0xc2b2ae3du;
+  static constexpr uint64 prime64_1 = 0x9e3779b185ebca87ull;
+  static constexpr uint64 prime64_2 = 0xc2b2ae3d27d4eb4full;
+  static constexpr uint64 prime64_3 = 0x165667b19e3779f9ull;
+  static constexpr uint64 prime64_4 = 0x85ebca77c2b2ae63ull;
+  static constexpr uint64 prime64_5 = 0x27d4eb2f165667c5ull;
+  static constexpr uint64 prime_mx1 = 0x165667919e3779f9ull;
+  static constexpr uint64 prime_mx2 = 0x9fb21c651e98df25ull;
+
+  static constexpr size_t secret_size = 192;
+  static constexpr size_t stripe_size = 64;
+
+  using secret_type = std::array<char, secret_size>;
+
+  static constexpr secret_type default_secret = [] {
+    constexpr uint8 bytes[secret_size] = {
+        0xb8, 0xfe, 0x6c, 0x39, 0x23, 0xa4, 0x4b, 0xbe, 0x7c, 0x01, 0x81, 0x2c,
+        0xf7, 0x21, 0xad, 0x1c, 0xde, 0xd4, 0x6d, 0xe9, 0x83, 0x90, 0x97, 0xdb,
+        0x72, 0x40, 0xa4, 0xa4, 0xb7, 0xb3, 0x67, 0x1f, 0xcb, 0x79, 0xe6, 0x4e,
+        0xcc, 0xc0, 0xe5, 0x78, 0x82, 0x5a, 0xd0, 0x7d, 0xcc, 0xff, 0x72, 0x21,
+        0xb8, 0x08, 0x46, 0x74, 0xf7, 0x43, 0x24, 0x8e, 0xe0, 0x35, 0x90, 0xe6,
+        0x81, 0x3a, 0x26, 0x4c, 0x3c, 0x28, 0x52, 0xbb, 0x91, 0xc3, 0x00, 0xcb,
+        0x88, 0xd0, 0x65, 0x8b, 0x1b, 0x53, 0x2e, 0xa3, 0x71, 0x64, 0x48, 0x97,
+        0xa2, 0x0d, 0xf9, 0x4e, 0x38, 0x19, 0xef, 0x46, 0xa9, 0xde, 0xac, 0xd8,
+        0xa8, 0xfa, 0x76, 0x3f, 0xe3, 0x9c, 0x34, 0x3f, 0xf9, 0xdc, 0xbb, 0xc7,
+        0xc7, 0x0b, 0x4f, 0x1d, 0x8a, 0x51, 0xe0, 0x4b, 0xcd, 0xb4, 0x59, 0x31,
+        0xc8, 0x9f, 0x7e, 0xc9, 0xd9, 0x78, 0x73, 0x64, 0xea, 0xc5, 0xac, 0x83,
+        0x34, 0xd3, 0xeb, 0xc3, 0xc5, 0x81, 0xa0, 0xff, 0xfa, 0x13, 0x63, 0xeb,
+        0x17, 0x0d, 0xdd, 0x51, 0xb7, 0xf0, 0xda, 0x49, 0xd3, 0x16, 0x55, 0x26,
+        0x29, 0xd4, 0x68, 0x9e, 0x2b, 0x16, 0xbe, 0x58, 0x7d, 0x47, 0xa1, 0xfc,
+        0x8f, 0xf8, 0xb8, 0xd1, 0x7a, 0xd0, 0x31, 0xce, 0x45, 0xcb, 0x3a, 0x8f,
+        0x95, 0x16, 0x04, 0x28, 0xaf, 0xd7, 0xfb, 0xca, 0xbb, 0x4b, 0x40, 0x7e};
+    secret_type result{};
+    for (size_t i = 0; i < secret_size; ++i)
+      result[i] = static_cast<char>(bytes[i]);
+    return result;
+  }();
+
+  static constexpr auto xorshift(uint64 x, int shift) noexcept -> uint64 {
+    return x ^ (x >> shift);
+  }
+
+  static constexpr auto avalanche(uint64 h) noexcept -> uint64 {
+    return xorshift(xorshift(h, 37) * prime_mx1, 32);
+  }
+
+  static constexpr auto xxh64_avalanche(uint64 h) noexcept -> uint64 {
+    h = xorshift(h, 33) * prime64_2;
+    h = xorshift(h, 29) * prime64_3;
+    return xorshift(h, 32);
+  }
+
+  static constexpr auto rrmxmx(uint64 h, uint64 size) noexcept -> uint64 {
+    h ^= std::rotl(h, 49) ^ std::rotl(h, 24);
+    h *= prime_mx2;
+    h ^= (h >> 35) + size;
+    h *= prime_mx2;
+    return xorshift(h, 28);
+  }
+
+  static constexpr auto mix16(czstring p, czstring s, uint64 seed) noexcept
+      -> uint64 {
+    return multiply_fold(read_le64(p) ^ (read_le64(s) + seed),
+                         read_le64(p + 8) ^ (read_le64(s + 8) - seed));
+  }
+
+  static constexpr auto hash_short(czstring p,
+                                   size_t size,
+                                   uint64 seed) noexcept -> uint64 {
+    const auto s = default_secret.data();
+    if (size > 8) {
+      const auto flip1 = (read_le64(s + 24) ^ read_le64(s + 32)) + seed;
+      const auto flip2 = (read_le64(s + 40) ^ read_le64(s + 48)) - seed;
+      const auto lo = read_le64(p) ^ flip1;
+      const auto hi = read_le64(p + size - 8) ^ flip2;
+      return avalanche(size + byteswap(lo) + hi + multiply_fold(lo, hi));
+    }
+    if (size >= 4) {
+      seed ^= uint64(byteswap(uint32(seed))) << 32;
+      const auto flip = (read_le64(s + 8) ^ read_le64(s + 16)) - seed;
+      const auto input = read_le32(p + size - 4) + (read_le32(p) << 32);
+      return rrmxmx(input ^ flip, size);
+    }
+    if (size > 0) {
+      const uint32 combined = (uint32(static_cast<uint8>(p[0])) << 16) |
+                              (uint32(static_cast<uint8>(p[size >> 1])) << 24) |
+                              uint32(static_cast<uint8>(p[size - 1])) |
+                              (uint32(size) << 8);
+      const auto flip = (read_le32(s) ^ read_le32(s + 4)) + seed;
+      return xxh64_avalanche(combined ^ flip);
+    }
+    return xxh64_avalanche(seed ^ read_le64(s + 56) ^ read_le64(s + 64));
+  }
+
+  static constexpr auto hash_medium(czstring p,
+                                    size_t size,
+                                    uint64 seed) noexcept -> uint64 {
+    const auto s = default_secret.data();
+    uint64 acc = size * prime64_1;
+    if (size <= 128) {
+      for (size_t i = (size - 1) / 32 + 1; i-- > 0;) {
+        acc += mix16(p + 16 * i, s + 32 * i, seed);
+        acc += mix16(p + size - 16 * (i + 1), s + 32 * i + 16, seed);
+      }
+      return avalanche(acc);
+    }
+    for (size_t i = 0; i < 8; ++i)
+      acc += mix16(p + 16 * i, s + 16 * i, seed);
+    auto end = mix16(p + size - 16, s + 136 - 17, seed);
+    acc = avalanche(acc);
+    for (size_t i = 8; i < size / 16; ++i)
+      end += mix16(p + 16 * i, s + 16 * (i - 8) + 3, seed);
+    return avalanche(acc + end);
+  }
+
+  static constexpr void accumulate(uint64* acc, czstring p, czstring s) {
+    for (size_t i = 0; i < 8; ++i) {
+      const auto value = read_le64(p + 8 * i);
+      const auto key = value ^ read_le64(s + 8 * i);
+      acc[i ^ 1] += value;
+      acc[i] += uint32(key) * (key >> 32);
+    }
+  }
+
+  static constexpr void scramble(uint64* acc, czstring s) {
+    for (size_t i = 0; i < 8; ++i)
+      acc[i] = (xorshift(acc[i], 47) ^ read_le64(s + 8 * i)) * prime32_1;
+  }
+
+  static constexpr auto hash_long(czstring p, size_t size, uint64 seed) noexcept
+      -> uint64 {
+    auto secret = default_secret;
+    if (seed)
+      for (size_t i = 0; i < secret_size; i += 16) {
+        const auto lo = read_le64(&default_secret[i]) + seed;
+        const auto hi = read_le64(&default_secret[i + 8]) - seed;
+        for (size_t j = 0; j < 8; ++j) {
+          secret[i + j] = static_cast<char>(lo >> (8 * j));
+          secret[i + 8 + j] = static_cast<char>(hi >> (8 * j));
+        }
+      }
+    const auto s = secret.data();
+    uint64 acc[8] = {prime32_3, prime64_1, prime64_2, prime64_3,
+                     prime64_4, prime32_2, prime64_5, prime32_1};
+    constexpr size_t stripes_per_block = (secret_size - stripe_size) / 8;
+    constexpr size_t block_size = stripe_size * stripes_per_block;
+    const size_t blocks = (size - 1) / block_size;
+    for (size_t n = 0; n < blocks; ++n) {
+      for (size_t i = 0; i < stripes_per_block; ++i)
+        accumulate(acc, p + n * block_size + i * stripe_size, s + i * 8);
+      scramble(acc, s + secret_size - stripe_size);
+    }
+    const size_t stripes = ((size - 1) - block_size * blocks) / stripe_size;
+    for (size_t i = 0; i < stripes; ++i)
+      accumulate(acc, p + blocks * block_size + i * stripe_size, s + i * 8);
+    accumulate(acc, p + size - stripe_size, s + secret_size - stripe_size - 7);
+
+    uint64 result = size * prime64_1;
+    for (size_t i = 0; i < 4; ++i)
+      result += multiply_fold(acc[2 * i] ^ read_le64(s + 11 + 16 * i),
+                              acc[2 * i + 1] ^ read_le64(s + 11 + 16 * i + 8));
+    return avalanche(result);
+  }
+};
+
+}  // namespace detail
+
+/// The 64-bit variant of XXH3 by Yann Collet with its default secret.
+/// It is fast for short strings and for long strings
+/// whose stripes are processed by independent accumulators.
+///
+constexpr auto xxh3(std::string_view str, uint64 seed = 0) noexcept -> uint64 {
+  using detail::xxh3;
+  const auto p = str.data();
+  const auto size = str.size();
+  if (size <= 16) return xxh3::hash_short(p, size, seed);
+  if (size <= 240) return xxh3::hash_medium(p, size, seed);
+  return xxh3::hash_long(p, size, seed);
+}
+
+/// Overloads for static strings.
+/// The terminating zero byte is not part of the hashed bytes.
+///
+template <size_t N>
+constexpr auto fnv1a(const static_zstring<N>& str) noexcept -> uint64 {
+  return fnv1a(std::string_view{str.data(), str.size()});
+}
+template <size_t N>
+constexpr auto wyhash(const static_zstring<N>& str, uint64 seed = 0) noexcept
+    -> uint64 {
+  return wyhash(std::string_view{str.data(), str.size()}, seed);
+}
+template <size_t N>
+constexpr auto xxh3(const static_zstring<N>& str, uint64 seed = 0) noexcept
+    -> uint64 {
+  return xxh3(std::string_view{str.data(), str.size()}, seed);
+}
+
+}  // namespace lyrahgames::xstd
@@ -0,0 +1,288 @@
+#pragma once
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <compare>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
+#include <stdexcept>
+#include <string_view>
+#include <vector>
+//
+#include <lyrahgames/xstd/static_zstring.hpp>
+#include <lyrahgames/xstd/string_hash.hpp>
+#include <lyrahgames/xstd/string_switch.hpp>
+#include <lyrahgames/xstd/utility.hpp>
+
+namespace lyrahgames::xstd {
+
+/// Handle of an interned string.
+/// Two handles of the same pool are equal
+/// if and only if their strings are equal.
+/// So, comparing and hashing strings reduces to integer operations.
+///
+struct string_id {
+  static constexpr uint32 invalid = -1;
+
+  friend constexpr auto operator<=>(string_id, string_id) noexcept = default;
+
+  uint32 value = invalid;
+};
+
+/// The 'string_pool' interns strings such that every distinct string
+/// is stored exactly once and represented by a 32-bit 'string_id'.
+///
+/// The given static strings are interned at compile time.
+/// Their ids are the positions inside the parameter list
+/// and can therefore be used as constants.
+/// Interning one of them at runtime is resolved by a 'string_switch'
+/// and does not touch the shared state of the pool.
+///
+/// All other strings are copied into arenas
+/// and found by a concurrent hash table.
+/// The table is split into shards which are selected by the hash value
+/// and protected by their own reader-writer lock.
+/// So, threads only contend when they access the same shard
+/// and lookups of already interned strings may run in parallel.
+/// The string of an id is read without any lock
+/// as the table from ids to strings is never moved.
+///
+/// using pool_type = string_pool<"if", "else", "while">;
+/// pool_type pool{};
+/// const auto id = pool.intern(token);
+/// if (id == pool_type::id<"while">) ...
+///
+template <static_zstring... statics>
+struct string_pool {
+  using static_switch = string_switch<statics...>;
+
+  static constexpr size_t static_count = sizeof...(statics);
+  static constexpr size_t shard_bits = 6;
+  static constexpr size_t shard_count = size_t{1} << shard_bits;
+  static constexpr size_t block_size = size_t{1} << 16;
+
+  /// The id of a static string known at compile time.
+  ///
+  template <static_zstring str>
+  static constexpr string_id id{
+      static_cast<uint32>(static_switch::template case_of<str>)};
+
+  string_pool() {
+    [[maybe_unused]] size_t i = 0;
+    ((entry(i++) = {statics.data(), statics.size()}), ...);
+    count.store(static_count, std::memory_order_relaxed);
+  }
+
+  string_pool(const string_pool&) = delete;
+  string_pool& operator=(const string_pool&) = delete;
+
+  ~string_pool() noexcept {
+    for (auto& segment : segments)
+      delete[] segment.load(std::memory_order_relaxed);
+  }
+
+  /// Returns the id of the given string.
+  /// If the string has not been interned before, it is copied into the pool.
+  ///
+  auto intern(std::string_view str) -> string_id {
+    if constexpr (static_count > 0) {
+      const auto i = static_switch::index(str);
+      if (i != static_switch::npos) return {static_cast<uint32>(i)};
+    }
+    const auto hash = wyhash(str);
+    auto& s = shard_of(hash);
+    {
+      std::shared_lock lock{s.mutex};
+      if (const auto id = s.find(*this, hash, str)) return *id;
+    }
+    std::unique_lock lock{s.mutex};
+    // Another thread may have inserted the string in the meantime.
+    if (const auto id = s.find(*this, hash, str)) return *id;
+    // Everything that may throw is done before the id is taken.
+    // So, a failed insertion neither uses up an id
+    // nor leaves an empty entry behind.
+    s.reserve();
+    const auto copy = s.store(str);
+    const auto value = next_id();
+    entry(value) = copy;
+    s.place({hash, static_cast<uint32>(value)});
+    return {static_cast<uint32>(value)};
+  }
+
+  /// Returns the id of the given string
+  /// or nothing if the string has not been interned.
+  ///
+  auto find(std::string_view str) const -> std::optional<string_id> {
+    if constexpr (static_count > 0) {
+      const auto i = static_switch::index(str);
+      if (i != static_switch::npos) return string_id{static_cast<uint32>(i)};
+    }
+    const auto hash = wyhash(str);
+    auto& s = shard_of(hash);
+    std::shared_lock lock{s.mutex};
+    return s.find(*this, hash, str);
+  }
+
+  /// Returns the interned string of the given id.
+  /// The string is zero-terminated and stays valid
+  /// as long as the pool exists.
+  ///
+  auto view(string_id id) const noexcept -> std::string_view {
+    return entry(id.value);
+  }
+
+  /// The amount of interned strings including the static strings.
+  ///
+  auto size() const noexcept -> size_t {
+    return count.load(std::memory_order_relaxed);
+  }
+
+  // The table from ids to strings consists of segments
+  // whose sizes grow geometrically.
+  // Segments are allocated on first use and never moved.
+  // So, all 32-bit ids are covered by a few segments.
+  //
+  static constexpr size_t first_segment_bits = 6;
+  static constexpr size_t segment_count = 33 - first_segment_bits;
+
+  static constexpr auto segment_of(size_t index) noexcept {
+    const auto i = index + (size_t{1} << first_segment_bits);
+    const size_t segment = std::bit_width(i) - 1 - first_segment_bits;
+    const size_t offset = i - (size_t{1} << (segment + first_segment_bits));
+    return std::pair{segment, offset};
+  }
+
+  auto entry(size_t index) const noexcept -> std::string_view {
+    const auto [segment, offset] = segment_of(index);
+    return segments[segment].load(std::memory_order_acquire)[offset];
+  }
+
+  // Ids are counted over all shards.
+  // The limit is checked and the segment of the id is allocated
+  // before the counter is incremented.
+  //
+  auto next_id() -> size_t {
+    auto value = count.load(std::memory_order_relaxed);
+    do {
+      if (value >= string_id::invalid) throw std::length_error(
+          "Too many strings have been interned into the string pool.");
+      entry(value);
+    } while (!count.compare_exchange_weak(value, value + 1,
+                                          std::memory_order_relaxed));
+    return value;
+  }
+
+  auto entry(size_t index) -> std::string_view& {
+    const auto [segment, offset] = segment_of(index);
+    auto& s = segments[segment];
+    auto data = s.load(std::memory_order_acquire);
+    if (!data) {
+      const auto size = size_t{1} << (segment + first_segment_bits);
+      auto fresh = new std::string_view[size]{};
+      if (s.compare_exchange_strong(data, fresh, std::memory_order_acq_rel))
+        data = fresh;
+      else
+        delete[] fresh;
+    }
+    return data[offset];
+  }
+
+  struct slot {
+    uint64 hash = 0;
+    uint32 id = string_id::invalid;
+  };
+
+  // Every shard owns an open-addressing table with linear probing
+  // and the arena its strings are copied to.
+  //
+  struct alignas(64) shard {
+    auto find(const string_pool& pool, uint64 hash, std::string_view str) const
+        -> std::optional<string_id> {
+      if (slots.empty()) return {};
+      const auto mask = slots.size() - 1;
+      for (auto i = size_t(hash) & mask;; i = (i + 1) & mask) {
+        const auto& s = slots[i];
+        if (s.id == string_id::invalid) return {};
+        if (s.hash == hash && pool.entry(s.id) == str) return string_id{s.id};
+      }
+    }
+
+    // Make room for one more slot.
+    // The load factor is kept below one half.
+    //
+    void reserve() {
+      if (2 * (size + 1) <= slots.size()) return;
+      std::vector<slot> old(std::max<size_t>(16, 2 * slots.size()));
+      swap(old, slots);
+      size = 0;
+      for (const auto& s : old)
+        if (s.id != string_id::invalid) place(s);
+    }
+
+    void place(slot s) noexcept {
+      const auto mask = slots.size() - 1;
+      auto i = size_t(s.hash) & mask;
+      while (slots[i].id != string_id::invalid)
+        i = (i + 1) & mask;
+      slots[i] = s;
+      ++size;
+    }
+
+    // Strings are stored with a terminating zero.
+    // Large strings get their own block.
+    //
+    auto store(std::string_view str) -> std::string_view {
+      const auto size = str.size() + 1;
+      char* data;
+      if (size > block_size / 4) {
+        blocks.push_back(std::make_unique<char[]>(size));
+        data = blocks.back().get();
+      } else {
+        if (size > free) {
+          blocks.push_back(std::make_unique<char[]>(block_size));
+          head = blocks.back().get();
+          free = block_size;
+        }
+        data = head;
+        head += size;
+        free -= size;
+      }
+      std::copy(str.begin(), str.end(), data);
+      data[str.size()] = '\0';
+      return {data, str.size()};
+    }
+
+    mutable std::shared_mutex mutex{};
+    std::vector<slot> slots{};
+    size_t size = 0;
+    std::vector<std::unique_ptr<char[]>> blocks{};
+    char* head = nullptr;
+    size_t free = 0;
+  };
+
+  // Shards are chosen by the high bits
+  // while the slots inside a shard are chosen by the low bits.
+  //
+  auto shard_of(uint64 hash) const noexcept -> const shard& {
+    return shards[hash >> (64 - shard_bits)];
+  }
+  auto shard_of(uint64 hash) noexcept -> shard& {
+    return shards[hash >> (64 - shard_bits)];
+  }
+
+  std::atomic<std::string_view*> segments[segment_count]{};
+  std::atomic<size_t> count{0};
+  shard shards[shard_count]{};
+};
+
+}  // namespace lyrahgames::xstd
+
+template <>
+struct std::hash<lyrahgames::xstd::string_id> {
+  auto operator()(lyrahgames::xstd::string_id id) const noexcept {
+    return std::hash<lyrahgames::xstd::uint32>{}(id.value);
+  }
+};
@@ -0,0 +1,129 @@
+#pragma once
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <string_view>
+//
+#include <lyrahgames/xstd/static_zstring.hpp>
+#include <lyrahgames/xstd/string_hash.hpp>
+#include <lyrahgames/xstd/utility.hpp>
+
+namespace lyrahgames::xstd {
+
+/// The 'string_switch' maps a runtime string to the index
+/// of one of the given static strings, called cases,
+/// such that strings can be used in 'switch' statements.
+/// All cases are hashed at compile time
+/// and it is checked that their hashes do not collide.
+/// Afterwards, a small table is chosen in which the hashes of all cases
+/// select distinct slots by some of their bits.
+/// So, a lookup needs one hash computation, one table access,
+/// and one verifying comparison, independent of the amount of cases.
+///
+/// using command = string_switch<"help", "version", "quit">;
+/// switch (command::index(argument)) {
+///   case command::case_of<"help">: ...
+///   case command::case_of<"quit">: ...
+///   case command::npos: ...
+/// }
+///
+template <static_zstring... cases>
+struct string_switch {
+  static constexpr size_t size = sizeof...(cases);
+  static constexpr size_t npos = -1;
+
+  static constexpr std::array<std::string_view, size> strings{
+      std::string_view{cases.data(), cases.size()}...};
+
+  static constexpr auto hash(std::string_view str) noexcept -> uint64 {
+    return wyhash(str);
+  }
+
+  static constexpr std::array<uint64, size> hashes{wyhash(cases)...};
+
+  static constexpr bool unique = [] {
+    auto s = strings;
+    std::sort(s.begin(), s.end());
+    return std::adjacent_find(s.begin(), s.end()) == s.end();
+  }();
+  static_assert(unique, "Cases of a string switch must be unique.");
+
+  static constexpr bool collision_free = [] {
+    auto h = hashes;
+    std::sort(h.begin(), h.end());
+    return std::adjacent_find(h.begin(), h.end()) == h.end();
+  }();
+  static_assert(collision_free, "Hashes of the given cases collide.");
+
+  // The slot of a hash is given by the bits starting at 'shift'.
+  // The smallest table for which some shift is free of collisions is used.
+  //
+  struct layout_type {
+    size_t bits;
+    size_t shift;
+  };
+  static constexpr auto layout = [] {
+    for (size_t bits = std::bit_width(std::bit_ceil(size)) - 1; bits < 16;
+         ++bits) {
+      for (size_t shift = 0; shift + bits <= 64; ++shift) {
+        auto slots = hashes;
+        for (auto& h : slots)
+          h = (h >> shift) & ((uint64{1} << bits) - 1);
+        std::sort(slots.begin(), slots.end());
+        if (std::adjacent_find(slots.begin(), slots.end()) == slots.end())
+          return layout_type{bits, shift};
+      }
+    }
+    return layout_type{0, 64};
+  }();
+  static_assert(layout.shift < 64, "No collision-free table has been found.");
+
+  static constexpr uint64 mask = (uint64{1} << layout.bits) - 1;
+
+  static constexpr auto table = [] {
+    std::array<uint32, (size_t{1} << layout.bits)> result{};
+    for (auto& x : result)
+      x = size;
+    for (size_t i = 0; i < size; ++i)
+      result[(hashes[i] >> layout.shift) & mask] = i;
+    return result;
+  }();
+
+  /// Returns the index of the case that equals the given string
+  /// or 'npos' if there is no such case.
+  ///
+  static constexpr auto index(std::string_view str) noexcept -> size_t {
+    const auto h = hash(str);
+    const size_t i = table[(h >> layout.shift) & mask];
+    if (i == size || hashes[i] != h || strings[i] != str) return npos;
+    return i;
+  }
+
+  /// The index of the given case as constant for 'case' labels.
+  ///
+  template <static_zstring str>
+  static constexpr size_t case_of = [] {
+    constexpr auto i = std::find(strings.begin(), strings.end(),
+                                 std::string_view{str.data(), str.size()}) -
+                       strings.begin();
+    static_assert(size_t(i) < size,
+                  "The given string is no case of the switch.");
+    return size_t(i);
+  }();
+
+  /// Call the function object with the case
+  /// that equals the given string as template argument.
+  /// Returns false and does not call the function object
+  /// if there is no such case.
+  ///
+  static constexpr bool visit(std::string_view str, auto&& f) {
+    const auto i = index(str);
+    size_t j = 0;
+    return ((i == j++ &&
+             (std::forward<decltype(f)>(f).template operator()<cases>(),
+              true)) ||
+            ...);
+  }
+};
+
+}  // namespace lyrahgames::xstd
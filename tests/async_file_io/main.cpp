@@ -0,0 +1,86 @@
+#include <iostream>
+#include <vector>
+//
+#include <lyrahgames/xstd/async_io.hpp>
+#include <lyrahgames/xstd/io.hpp>
+
+using namespace std;
+using namespace lyrahgames::xstd;
+
+// Run the same checks for every backend.
+bool check(async_file_io::backend backend) {
+  async_file_io io{backend};
+  cout << (io.uses_io_uring() ? "io_uring" : "poll") << '\n';
+
+  // Transfer a message through a pipe.
+  int fds[2];
+  if (::pipe(fds) == -1) return false;
+  char buffer[64]{};
+  auto read = io.read(fds[0], buffer);
+  // Nobody has written anything into the pipe yet.
+  if (read.available()) return false;
+  const string_view message = "Hello, World!";
+  auto write = io.write(fds[1], message);
+  // Do some frame work in between.
+  int frames = 0;
+  while (!read.available())
+    ++frames;
+  if (write.get() != message.size()) return false;
+  if (string_view(buffer, read.get()) != message) return false;
+  ::close(fds[0]);
+  ::close(fds[1]);
+
+  // Several reads may wait for the same pipe.
+  // The one that takes the data must not block the others.
+  {
+    int first[2], second[2];
+    if (::pipe(first) == -1 || ::pipe(second) == -1) return false;
+    char x{}, y{}, z{};
+    auto a = io.read(first[0], span{&x, 1});
+    auto b = io.read(first[0], span{&y, 1});
+    if (::write(first[1], "a", 1) != 1) return false;
+    while (!a.available() && !b.available())
+      ;
+    // Another pipe with available data can still be read.
+    if (::write(second[1], "c", 1) != 1) return false;
+    auto c = io.read(second[0], span{&z, 1});
+    if (c.get() != 1 || z != 'c') return false;
+    if (::write(first[1], "b", 1) != 1) return false;
+    if (a.get() != 1 || b.get() != 1) return false;
+    if (!((x == 'a' && y == 'b') || (x == 'b' && y == 'a'))) return false;
+    for (auto fd : {first[0], first[1], second[0], second[1]})
+      ::close(fd);
+  }
+
+  // Read a regular file at a given offset.
+  const auto path = filesystem::temp_directory_path() / "xstd-async-file-io";
+  string_to_file("0123456789", path.c_str());
+  const auto file = open_file(path.c_str());
+  auto chunk = io.read(file.get(), span{buffer, 4}, 3);
+  if (string_view(buffer, chunk.get()) != "3456") return false;
+
+  // A burst of requests larger than the queues must not stall.
+  {
+    async_file_io small{backend, 4};
+    vector<char> bytes(1024);
+    vector<async_state<size_t>> reads{};
+    for (size_t i = 0; i < bytes.size(); ++i)
+      reads.push_back(small.read(file.get(), span{&bytes[i], 1}, i % 10));
+    for (size_t i = 0; i < bytes.size(); ++i)
+      if (reads[i].get() != 1 || bytes[i] != char('0' + i % 10)) return false;
+  }
+  filesystem::remove(path);
+
+  // Errors are reported by the future.
+  try {
+    io.read(-1, buffer).get();
+    return false;
+  } catch (runtime_error&) {
+  }
+  return true;
+}
+
+int main() {
+  if (!check(async_file_io::backend::automatic)) return 1;
+  if (!check(async_file_io::backend::poll)) return 1;
+}
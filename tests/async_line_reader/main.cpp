@@ -0,0 +1,24 @@
+#include <lyrahgames/xstd/async_io.hpp>
+
+using namespace std;
+using namespace lyrahgames::xstd;
+
+int main() {
+  async_line_reader reader{};
+  // Sequentially wait for all lines until the input is closed.
+  while (const auto line = reader.get())
+    cout << *line << endl;
+  if (!reader.done()) return 1;
+
+  // Stopping a reader that waits for input must not block.
+  int fds[2];
+  if (::pipe(fds) == -1) return 1;
+  {
+    async_line_reader blocked{fds[0]};
+    if (blocked.get_for(10ms)) return 1;
+    blocked.stop();
+    if (!blocked.done()) return 1;
+  }
+  ::close(fds[0]);
+  ::close(fds[1]);
+}
@@ -34,4 +34,33 @@ int main() {
     const auto time = duration<float32>([] { this_thread::sleep_for(200ms); });
     cout << setw(15) << "time = " << time.count() << '\n';
   }
+  {
+    // The first measurement must not include the calibration.
+    const auto time = duration<float64, tsc_clock>([] {});
+    cout << setw(15) << "first = " << time.count() << '\n';
+  }
+  {
+    cout << setw(15) << "invariant = " << boolalpha << tsc_clock::invariant()
+         << '\n'
+         << setw(15) << "frequency = " << tsc_clock::frequency() << '\n';
+    const auto time = duration<float64, tsc_clock>(
+        [] { this_thread::sleep_for(200ms); });
+    cout << setw(15) << "time = " << time.count() << '\n';
+    const auto overhead = benchmark([] { return tsc_clock::now(); });
+    cout << setw(15) << "overhead = " << overhead.median().count() << '\n';
+  }
+  {
+    const auto result = benchmark([n = 1'000]() mutable {
+      do_not_optimize(n);
+      return sum(n);
+    });
+    cout << setw(15) << "iterations = " << result.iterations << '\n'
+         << setw(15) << "samples = " << result.samples.size() << '\n'
+         << setw(15) << "min = " << result.min().count() << '\n'
+         << setw(15) << "median = " << result.median().count() << '\n'
+         << setw(15) << "mean = " << result.mean().count() << '\n'
+         << setw(15) << "stddev = " << result.stddev().count() << '\n'
+         << setw(15) << "p99 = " << result.percentile(99).count() << '\n'
+         << setw(15) << "max = " << result.max().count() << '\n';
+  }
 }
@@ -0,0 +1,47 @@
+#include <lyrahgames/xstd/async_io.hpp>
+#include <lyrahgames/xstd/coroutine.hpp>
+
+using namespace std;
+using namespace lyrahgames::xstd;
+
+task<size_t> count_words(string_view line) {
+  size_t count = 0;
+  bool word = false;
+  for (auto c : line) {
+    if ((c != ' ') && !word) ++count;
+    word = (c != ' ');
+  }
+  co_return count;
+}
+
+// Sequential-looking input handling
+// which is suspended while waiting for the next line.
+task<> echo(async_line_reader& reader, task_executor& executor) {
+  size_t lines = 0;
+  while (const auto line = co_await reader.async_get(executor)) {
+    const auto words = co_await count_words(*line);
+    cout << *line << " (" << words << ")" << endl;
+    ++lines;
+  }
+  cout << lines << " lines" << endl;
+}
+
+task<> fail(task_executor& executor) {
+  co_await executor.schedule();
+  throw runtime_error("Task failed.");
+}
+
+int main() {
+  task_executor executor{};
+  async_line_reader reader{};
+  executor.spawn(echo(reader, executor));
+  executor.run();
+
+  // Exceptions of spawned tasks are forwarded to the caller of 'run'.
+  executor.spawn(fail(executor));
+  try {
+    executor.run();
+    return 1;
+  } catch (runtime_error&) {
+  }
+}
@@ -0,0 +1,42 @@
+// The library requires C++20 only.
+// This test makes sure that headers which are otherwise only tested
+// with the latest standard do not rely on newer features.
+#include <cstdlib>
+#include <string_view>
+//
+#include <lyrahgames/xstd/static_radix_tree.hpp>
+#include <lyrahgames/xstd/string_hash.hpp>
+#include <lyrahgames/xstd/string_pool.hpp>
+#include <lyrahgames/xstd/string_switch.hpp>
+
+using namespace std;
+using namespace lyrahgames;
+using namespace xstd;
+
+static_assert(__cplusplus == 202002L);
+
+// Short inputs of XXH3 are mixed by byte swaps.
+static_assert(xxh3("abcdef", 7) == 0xf014ccf5b557914aull);
+static_assert(xxh3("message digest") == 0x160d8e9329be94f9ull);
+
+int main() {
+  // Make sure that the runtime paths are instantiated as well.
+  const string_view input = "message digest";
+  const string_view short_input = "abcdef";
+  if (xxh3(input) != 0x160d8e9329be94f9ull ||
+      xxh3(short_input, 7) != 0xf014ccf5b557914aull)
+    return EXIT_FAILURE;
+
+  using keywords = string_switch<"if", "else", "while">;
+  if (keywords::index(input) != keywords::npos) return EXIT_FAILURE;
+
+  using tree = static_radix_tree::construction<"hello", "help", "world">;
+  const string_view key = "help";
+  if (!static_radix_tree::visit<tree>(key, []<static_zstring> {}))
+    return EXIT_FAILURE;
+
+  string_pool<"if", "else"> pool{};
+  if (pool.intern("else") != pool.id<"else"> ||
+      pool.intern(input) != pool.intern(input))
+    return EXIT_FAILURE;
+}
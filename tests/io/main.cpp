@@ -1,3 +1,5 @@
+#include <filesystem>
+//
 #include <lyrahgames/xstd/io.hpp>
 
 using namespace std;
@@ -6,4 +8,65 @@ using namespace lyrahgames::xstd;
 int main(int argc, char* argv[]) {
   const auto text = string_from_file(argv[1]);
   cout << text << flush;
+
+  // Reading into an uninitialized buffer yields the same content.
+  if (buffer_from_file(argv[1]).view() != text) return 1;
+
+  // The memory-mapped view has to provide exactly the same content.
+  mapped_file file{argv[1]};
+  if (file.view() != text) return 1;
+  if (file.bytes().size() != text.size()) return 1;
+
+  // Moving transfers the ownership of the mapping.
+  mapped_file other = std::move(file);
+  if (!file.empty() || other.view() != text) return 1;
+
+  // Streaming the file in small chunks and lines
+  // has to reproduce the whole content.
+  char chunk_buffer[7];
+  string chunks{};
+  for (auto chunk : chunk_reader{argv[1], chunk_buffer})
+    chunks += chunk;
+  if (chunks != text) return 1;
+  //
+  // Use a buffer smaller than most lines to force its enlargement.
+  string line_buffer(5, '\0');
+  string lines{};
+  for (auto line : line_reader{argv[1], line_buffer}) {
+    lines += line;
+    lines += '\n';
+  }
+  if (lines != text) return 1;
+
+  // Loading a batch of files reports errors per file.
+  const auto batch = strings_from_files(
+      vector<string>{argv[1], "non-existing-file.txt", argv[1]}, 2);
+  if (batch.size() != 3) return 1;
+  if (batch[0] != text || batch[2] != text) return 1;
+  if (!batch.failed(1) || batch.failed(0)) return 1;
+
+  // Writing and reading again has to reproduce the content.
+  const auto output = filesystem::temp_directory_path() / "xstd-io-test.txt";
+  string_to_file(text, output.c_str());
+  if (string_from_file(output.c_str()) != text) return 1;
+  {
+    // Use a small buffer to mix buffered and direct writes.
+    file_writer writer{output.c_str(), file_writer::mode::atomic_replace, 16};
+    const string_view pieces[] = {"a", string_view{text}, "b"};
+    writer << "Hello" << ',' << " World!";
+    writer.write(pieces);
+    // Nothing is visible before closing the writer.
+    if (string_from_file(output.c_str()) != text) return 1;
+    writer.close();
+  }
+  if (string_from_file(output.c_str()) != "Hello, World!a" + text + "b")
+    return 1;
+  filesystem::remove(output);
+
+  // Same error semantics as for reading the file into a string.
+  try {
+    mapped_file{"non-existing-file.txt"};
+    return 1;
+  } catch (runtime_error&) {
+  }
 }
@@ -0,0 +1,219 @@
+#include <algorithm>
+#include <filesystem>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <vector>
+//
+#include <lyrahgames/xstd/chrono.hpp>
+#include <lyrahgames/xstd/io.hpp>
+
+using namespace std;
+using namespace lyrahgames;
+using namespace xstd;
+
+namespace {
+
+const auto directory = filesystem::temp_directory_path() / "xstd-io-benchmark";
+
+// Print the time of the given benchmark together with some results
+// such that all variants can be cross-checked.
+void print(string_view name, auto time, size_t count, size_t length) {
+  cout << setw(30) << name << " = " << setw(10) << time.count() << " s"
+       << setw(12) << count << " files/lines" << setw(14) << length
+       << " bytes\n";
+}
+
+// Generate a file of random lines with the given size in MiB.
+void generate_lines(const filesystem::path& path, size_t mebibytes) {
+  mt19937 rng{random_device{}()};
+  uniform_int_distribution<size_t> length{0, 120};
+  uniform_int_distribution<int> letter{'a', 'z'};
+  ofstream file{path, ios::binary};
+  string line{};
+  size_t size = 0;
+  while (size < (mebibytes << 20)) {
+    line.resize(length(rng));
+    for (auto& c : line)
+      c = letter(rng);
+    file << line << '\n';
+    size += line.size() + 1;
+  }
+}
+
+void benchmark_line_reading(size_t mebibytes) {
+  const auto path = directory / "lines.txt";
+  generate_lines(path, mebibytes);
+  cout << "\nline reading of " << mebibytes << " MiB\n";
+
+  // Every benchmark counts the lines and their total length.
+  size_t count = 0, length = 0;
+  const auto check = [&](string_view name, auto&& f) {
+    count = length = 0;
+    const auto time = duration(f);
+    print(name, time, count, length);
+  };
+
+  check("string_from_file + getline", [&] {
+    istringstream input{string_from_file(path.c_str())};
+    string line{};
+    while (getline(input, line)) {
+      ++count;
+      length += line.size();
+    }
+  });
+
+  check("ifstream + getline", [&] {
+    ifstream input{path};
+    string line{};
+    while (getline(input, line)) {
+      ++count;
+      length += line.size();
+    }
+  });
+
+  check("chunk_reader", [&] {
+    static char buffer[1 << 16];
+    for (auto chunk : chunk_reader{path.c_str(), buffer}) {
+      count += std::count(chunk.begin(), chunk.end(), '\n');
+      length += chunk.size();
+    }
+    length -= count;
+  });
+
+  check("line_reader", [&] {
+    string buffer{};
+    for (auto line : line_reader{path.c_str(), buffer}) {
+      ++count;
+      length += line.size();
+    }
+  });
+}
+
+void benchmark_whole_file_reading(size_t mebibytes) {
+  const auto path = directory / "lines.txt";
+  generate_lines(path, mebibytes);
+  cout << "\nwhole file reading of " << mebibytes << " MiB\n";
+
+  const auto check = [&](string_view name, auto&& f) {
+    size_t length = 0;
+    const auto time = duration([&] { length = f(); });
+    print(name, time, 1, length);
+  };
+
+  check("zero-filled string + ifstream", [&] {
+    ifstream file{path, ios::binary | ios::ate};
+    string result(file.tellg(), '\0');
+    file.seekg(0);
+    file.read(result.data(), result.size());
+    return result.size();
+  });
+
+  check("string_from_file", [&] {  //
+    return string_from_file(path.c_str()).size();
+  });
+
+  check("buffer_from_file", [&] {  //
+    return buffer_from_file(path.c_str()).size();
+  });
+
+  // Mapping alone does not load anything.
+  // For a fair comparison, every page has to be touched once.
+  check("mapped_file", [&] {
+    const mapped_file file{path.c_str()};
+    [[maybe_unused]] volatile char sink{};
+    for (size_t i = 0; i < file.size(); i += 4096)
+      sink = file.data()[i];
+    return file.size();
+  });
+}
+
+// Evict the pages of all given files from the page cache
+// to simulate the first start of an application.
+// Dirty pages cannot be evicted and need to be written back first.
+void drop_page_cache(const vector<string>& paths) {
+  for (const auto& path : paths) {
+    const auto file = open_file(path.c_str());
+    ::fdatasync(file.get());
+    ::posix_fadvise(file.get(), 0, 0, POSIX_FADV_DONTNEED);
+  }
+}
+
+void benchmark_batch_loading(size_t file_count) {
+  mt19937 rng{random_device{}()};
+  uniform_int_distribution<size_t> size{256, 16 << 10};
+  vector<string> paths{};
+  for (size_t i = 0; i < file_count; ++i) {
+    paths.push_back(directory / ("file-" + to_string(i) + ".txt"));
+    ofstream{paths.back(), ios::binary} << string(size(rng), 'x');
+  }
+  cout << "\nbatch loading of " << file_count << " files\n";
+
+  const auto check = [&](string_view name, auto&& f) {
+    for (auto cache : {"cold", "warm"}) {
+      if (cache == "cold"sv) drop_page_cache(paths);
+      size_t length = 0;
+      const auto time = duration([&] { length = f(); });
+      print(string(name) + " (" + cache + ")", time, file_count, length);
+    }
+  };
+
+  check("string_from_file loop", [&] {
+    size_t length = 0;
+    for (const auto& path : paths)
+      length += string_from_file(path.c_str()).size();
+    return length;
+  });
+
+  check("strings_from_files", [&] {
+    const auto batch = strings_from_files(paths);
+    size_t length = 0;
+    for (size_t i = 0; i < batch.size(); ++i)
+      length += batch[i].size();
+    return length;
+  });
+}
+
+void benchmark_small_writes(size_t count) {
+  const auto path = directory / "output.txt";
+  cout << "\nwriting of " << count << " small pieces\n";
+
+  const auto check = [&](string_view name, auto&& f) {
+    const auto time = duration(f);
+    print(name, time, count, filesystem::file_size(path));
+  };
+
+  check("ofstream", [&] {
+    ofstream file{path, ios::binary};
+    for (size_t i = 0; i < count; ++i)
+      file << "key = " << char('0' + i % 10) << '\n';
+  });
+
+  check("file_writer", [&] {
+    file_writer file{path.c_str()};
+    for (size_t i = 0; i < count; ++i)
+      file << "key = " << char('0' + i % 10) << '\n';
+    file.close();
+  });
+
+  check("file_writer (atomic)", [&] {
+    file_writer file{path.c_str(), file_writer::mode::atomic_replace};
+    for (size_t i = 0; i < count; ++i)
+      file << "key = " << char('0' + i % 10) << '\n';
+    file.close();
+  });
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  const size_t mebibytes = (argc > 1) ? stoul(argv[1]) : 16;
+  const size_t file_count = (argc > 2) ? stoul(argv[2]) : 2000;
+  const size_t write_count = (argc > 3) ? stoul(argv[3]) : 10'000'000;
+  filesystem::create_directories(directory);
+  benchmark_line_reading(mebibytes);
+  benchmark_whole_file_reading(mebibytes);
+  benchmark_batch_loading(file_count);
+  benchmark_small_writes(write_count);
+  filesystem::remove_all(directory);
+}
@@ -0,0 +1,84 @@
+#include <doctest/doctest.h>
+//
+#include <random>
+#include <thread>
+#include <vector>
+//
+#include <lyrahgames/xstd/latency_histogram.hpp>
+
+using namespace std;
+using namespace lyrahgames::xstd;
+
+TEST_CASE("Latency Histogram Buckets") {
+  using histogram = latency_histogram<chrono::nanoseconds, 4>;
+  // Small values are stored exactly.
+  for (uint64 i = 0; i < histogram::sub_buckets; ++i) {
+    CHECK(histogram::bucket_index(i) == i);
+    CHECK(histogram::bucket_lower_bound(i) == i);
+    CHECK(histogram::bucket_upper_bound(i) == i);
+  }
+  // Bucket bounds are consistent with the bucket index.
+  for (size_t i = 0; i < histogram::bucket_count; ++i) {
+    CHECK(histogram::bucket_index(histogram::bucket_lower_bound(i)) == i);
+    CHECK(histogram::bucket_index(histogram::bucket_upper_bound(i)) == i);
+  }
+  CHECK(histogram::bucket_index(~uint64{0}) == histogram::bucket_count - 1);
+}
+
+SCENARIO("Latency Histogram Percentiles") {
+  latency_histogram histogram{};
+  CHECK(histogram.empty());
+  CHECK(histogram.percentile(99) == 0ns);
+
+  for (uint64 i = 1; i <= 10'000; ++i)
+    histogram.record(chrono::microseconds(i));
+  CHECK(histogram.count() == 10'000);
+  CHECK(histogram.mean().count() == doctest::Approx(5'000'500.0));
+
+  // The relative error is bounded by the precision.
+  // The extremes are given by the bounds of their buckets.
+  const auto error = 1.0 / (1 << 5);
+  CHECK(histogram.min() <= 1us);
+  CHECK(float64(histogram.min().count()) >= 1'000 * (1 - error));
+  CHECK(histogram.max() >= 10'000us);
+  CHECK(float64(histogram.max().count()) <= 10'000'000 * (1 + error));
+  for (auto p : {1.0, 25.0, 50.0, 90.0, 99.0, 99.9, 100.0}) {
+    const auto expected = p / 100 * 10'000'000;
+    const auto value = float64(histogram.percentile(p).count());
+    CHECK(value >= expected * (1 - error));
+    CHECK(value <= expected * (1 + error));
+  }
+}
+
+SCENARIO("Concurrent Latency Histogram Recording and Merging") {
+  using histogram = latency_histogram<>;
+  const auto upper_bound = [](uint64 value) {
+    return chrono::nanoseconds(
+        histogram::bucket_upper_bound(histogram::bucket_index(value)));
+  };
+
+  histogram shared{};
+  vector<thread> threads{};
+  for (int t = 0; t < 4; ++t)
+    threads.emplace_back([&shared] {
+      for (uint64 i = 0; i < 10'000; ++i)
+        shared.record(i);
+    });
+  for (auto& t : threads)
+    t.join();
+  CHECK(shared.count() == 40'000);
+  CHECK(shared.min() == 0ns);
+  CHECK(shared.max() == upper_bound(9'999));
+
+  histogram other{};
+  other.record(1s);
+  other.merge(shared);
+  CHECK(other.count() == 40'001);
+  CHECK(other.min() == 0ns);
+  CHECK(other.max() == upper_bound(1'000'000'000));
+  CHECK(other.percentile(100) == other.max());
+
+  other.reset();
+  CHECK(other.empty());
+  CHECK(other.max() == 0ns);
+}
@@ -0,0 +1,79 @@
+#include <doctest/doctest.h>
+//
+#include <sstream>
+#include <thread>
+//
+#include <lyrahgames/xstd/profile.hpp>
+
+using namespace std;
+using namespace lyrahgames::xstd;
+
+namespace {
+
+void update() {
+  profile_zone<"update"> zone{};
+  for (int i = 0; i < 3; ++i) {
+    profile_zone<"step"> zone{};
+  }
+}
+
+}  // namespace
+
+SCENARIO("Profile Zones") {
+  profile_collector collector{};
+  collector.collect(false);
+  collector.clear();
+
+  thread worker{[] { update(); }};
+  update();
+  worker.join();
+  collector.collect();
+
+  CHECK(collector.dropped == 0);
+  CHECK(collector.events.size() == 8);
+  CHECK(collector.zones.size() == 2);
+  CHECK(collector.zones["update"].count == 2);
+  CHECK(collector.zones["step"].count == 6);
+  // Nested zones cannot take longer than their parents.
+  CHECK(collector.zones["step"].ticks <= collector.zones["update"].ticks);
+
+  stringstream trace{};
+  collector.write_chrome_trace(trace);
+  CHECK(trace.str().find("\"name\":\"update\"") != string::npos);
+  CHECK(trace.str().find("\"ph\":\"X\"") != string::npos);
+
+  // Already collected events are not collected twice.
+  collector.clear();
+  collector.collect();
+  CHECK(collector.events.empty());
+}
+
+SCENARIO("Profile Zones: Buffers of Finished Threads") {
+  profile_collector collector{};
+  collector.collect(false);
+  const auto buffers = detail::profile_buffers.buffers.size();
+
+  // Short-lived threads must not make the registry grow.
+  for (int i = 0; i < 16; ++i) {
+    thread worker{[] { update(); }};
+    worker.join();
+  }
+  collector.clear();
+  collector.collect();
+  CHECK(collector.zones["update"].count == 16);
+  CHECK(collector.zones["step"].count == 48);
+  CHECK(detail::profile_buffers.buffers.size() == buffers);
+}
+
+SCENARIO("Profile Zones: Escaped Trace Names") {
+  profile_collector collector{};
+  collector.collect(false);
+  collector.clear();
+  {
+    profile_zone<"say \"hi\"\\\n"> zone{};
+  }
+  collector.collect();
+  stringstream trace{};
+  collector.write_chrome_trace(trace);
+  CHECK(trace.str().find(R"("name":"say \"hi\"\\\u000a")") != string::npos);
+}
@@ -0,0 +1,105 @@
+#include <doctest/doctest.h>
+//
+#include <map>
+#include <random>
+#include <string>
+#include <vector>
+//
+#include <lyrahgames/xstd/radix_tree.hpp>
+
+using namespace std;
+using namespace lyrahgames::xstd;
+
+SCENARIO("Radix Tree: Insertion, Lookup, and Prefix Matching") {
+  radix_tree<int> tree{};
+  CHECK(tree.empty());
+  CHECK(tree.insert("help", 1).second);
+  CHECK(tree.insert("hel", 2).second);
+  CHECK(tree.insert("helo", 3).second);
+  CHECK(tree.insert("version", 4).second);
+  CHECK(tree.insert("verbose", 5).second);
+  CHECK(!tree.insert("help", 6).second);
+  CHECK(tree.size() == 5);
+
+  CHECK(*tree.find("help") == 1);
+  CHECK(*tree.find("hel") == 2);
+  CHECK(tree.find("he") == nullptr);
+  CHECK(tree.find("helpme") == nullptr);
+  CHECK(tree.find("") == nullptr);
+
+  const auto [size, value] = tree.longest_prefix("help-me");
+  CHECK(size == 4);
+  CHECK(*value == 1);
+  CHECK(tree.longest_prefix("he").second == nullptr);
+
+  string_view prefix{}, tail{};
+  CHECK(tree.traverse("verbosely", [&](string_view p, int& v, string_view t) {
+    prefix = p;
+    tail = t;
+    v = 7;
+  }) == 7);
+  CHECK(prefix == "verbose");
+  CHECK(tail == "ly");
+  CHECK(*tree.find("verbose") == 7);
+  CHECK(!tree.traverse("xyz", [](auto...) {}));
+  CHECK(tree.visit("hel", [](string_view key, int v) {
+    CHECK(key == "hel");
+    CHECK(v == 2);
+  }));
+  CHECK(!tree.visit("helpme", [](auto...) {}));
+
+  vector<string> keys{};
+  tree.for_each([&](string_view key, int) { keys.emplace_back(key); });
+  CHECK(keys == vector<string>{"hel", "helo", "help", "verbose", "version"});
+}
+
+SCENARIO("Radix Tree: Random Operations Compared to Map") {
+  mt19937 rng{12345};
+  uniform_int_distribution<size_t> length{0, 6};
+  uniform_int_distribution<int> letter{'a', 'h'};
+  const auto random_key = [&] {
+    string key(length(rng), ' ');
+    for (auto& c : key)
+      c = letter(rng);
+    return key;
+  };
+
+  radix_tree<int> tree{};
+  map<string, int, less<>> reference{};
+  for (int i = 0; i < 20'000; ++i) {
+    const auto key = random_key();
+    switch (rng() % 3) {
+      case 0:
+        CHECK(tree.insert(key, i).second == reference.emplace(key, i).second);
+        break;
+      case 1:
+        CHECK(tree.erase(key) == bool(reference.erase(key)));
+        break;
+      default: {
+        const auto it = reference.find(key);
+        const auto value = tree.find(key);
+        REQUIRE((it != reference.end()) == (value != nullptr));
+        if (value) CHECK(*value == it->second);
+
+        size_t size = key.size() + 1;
+        while (size-- > 0)
+          if (reference.contains(key.substr(0, size))) break;
+        const auto match = tree.longest_prefix(key);
+        if (size == size_t(-1))
+          CHECK(match.second == nullptr);
+        else
+          CHECK(match.first == size);
+      }
+    }
+    CHECK(tree.size() == reference.size());
+  }
+
+  auto it = reference.begin();
+  tree.for_each([&](string_view key, int value) {
+    REQUIRE(it != reference.end());
+    CHECK(key == it->first);
+    CHECK(value == it->second);
+    ++it;
+  });
+  CHECK(it == reference.end());
+}
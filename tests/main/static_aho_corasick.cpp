@@ -0,0 +1,69 @@
+#include <doctest/doctest.h>
+//
+#include <algorithm>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+//
+#include <lyrahgames/xstd/static_aho_corasick.hpp>
+
+using namespace std;
+using namespace lyrahgames::xstd;
+
+namespace {
+
+using automaton =
+    static_aho_corasick<"he", "she", "his", "hers", "error", "err", "rr">;
+
+auto naive_find_all(string_view text) {
+  vector<pair<size_t, size_t>> matches{};
+  for (size_t i = 0; i < text.size(); ++i)
+    for (size_t k = 0; k < automaton::key_count; ++k)
+      if (text.substr(i).starts_with(automaton::strings[k]))
+        matches.emplace_back(k, i);
+  ranges::sort(matches, {}, [](auto m) { return pair{m.second, m.first}; });
+  return matches;
+}
+
+}  // namespace
+
+SCENARIO("Static Aho-Corasick: Find All Occurrences") {
+  vector<pair<size_t, size_t>> matches{};
+  automaton::find_all("ushers", [&](size_t key, size_t offset) {
+    matches.emplace_back(key, offset);
+  });
+  ranges::sort(matches, {}, [](auto m) { return pair{m.second, m.first}; });
+  CHECK(matches == vector<pair<size_t, size_t>>{{1, 1}, {0, 2}, {3, 2}});
+
+  constexpr auto count = [] {
+    size_t n = 0;
+    automaton::find_all("errorr", [&](size_t, size_t) { ++n; });
+    return n;
+  }();
+  // "err", "error", "rr" twice
+  static_assert(count == 4);
+}
+
+SCENARIO("Static Aho-Corasick: Chunked Scanning") {
+  mt19937 rng{1234};
+  uniform_int_distribution<int> letter{0, 6};
+  string text(50'000, ' ');
+  for (auto& c : text)
+    c = "ehisro "[letter(rng)];
+  const auto expected = naive_find_all(text);
+
+  // Large chunks are scanned by interleaved lanes.
+
+  for (size_t chunk_size : {1, 2, 3, 7, 64, 20'000, 50'000}) {
+    vector<pair<size_t, size_t>> matches{};
+    automaton::scanner scanner{};
+    for (size_t i = 0; i < text.size(); i += chunk_size)
+      scanner.scan(string_view{text}.substr(i, chunk_size),
+                   [&](size_t key, size_t offset) {
+                     matches.emplace_back(key, offset);
+                   });
+    ranges::sort(matches, {}, [](auto m) { return pair{m.second, m.first}; });
+    CHECK(matches == expected);
+  }
+}
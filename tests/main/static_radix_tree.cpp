@@ -3,6 +3,8 @@
 #include <iomanip>
 #include <iostream>
 //
+#include <sys/mman.h>
+//
 #include <lyrahgames/xstd/meta.hpp>
 #include <lyrahgames/xstd/static_radix_tree.hpp>
 
@@ -102,3 +104,330 @@ SCENARIO("") {
   traverse("key=uiae");
   traverse("xyz");
 }
+
+SCENARIO("Static Radix Tree: Perfect Hash Visit") {
+  static_assert(is_same_v<
+                srt::leaves<tree>,
+                value_list<"abc"_sz, "cheat"_sz, "check"_sz, "hel"_sz,
+                           "helo"_sz, "help"_sz, "help-me"_sz, "in"_sz,
+                           "input"_sz, "key"_sz, "make"_sz, "man"_sz,
+                           "out"_sz, "output"_sz, "verbose"_sz, "version"_sz>>);
+  static_assert(srt::leaf_count<tree> == 16);
+
+  for (auto str : {"check", "help", "help-me", "hel", "he", "mine", "",
+                   "verbose", "versions", "outpu", "key"}) {
+    string visited{};
+    string hash_visited{};
+    const auto found = srt::visit<tree>(
+        str, [&]<static_zstring s> { visited = s.data(); });
+    const auto hash_found = srt::hash_visit<tree>(
+        str, [&]<static_zstring s> { hash_visited = s.data(); });
+    CHECK(found == hash_found);
+    CHECK(visited == hash_visited);
+  }
+}
+
+SCENARIO("Static Radix Tree: Chunked Prefix Match") {
+  using srt::detail::prefix_match;
+  constexpr static_zstring prefix = "/api/v1/users/profile/settings";
+
+  // Strings are put at the end of a page followed by a protected page.
+  // So, reading behind the terminator across the boundary would crash.
+  const auto page =
+      static_cast<char*>(mmap(nullptr, 8192, PROT_READ | PROT_WRITE,
+                              MAP_PRIVATE | MAP_ANONYMOUS, -1, 0));
+  REQUIRE(page != MAP_FAILED);
+  mprotect(page + 4096, 4096, PROT_NONE);
+
+  for (size_t size = 0; size <= prefix.size() + 2; ++size) {
+    for (bool corrupt : {false, true}) {
+      const auto str = page + 4096 - size - 1;
+      for (size_t i = 0; i < size; ++i)
+        str[i] = (i < prefix.size()) ? prefix[i] : '/';
+      if (corrupt && size) str[size / 2] ^= 1;
+      str[size] = '\0';
+
+      const bool match = (size >= prefix.size()) && !corrupt;
+      const auto tail = prefix_match<prefix>(czstring(str));
+      CHECK((tail != nullptr) == match);
+      if (match) CHECK(tail == str + prefix.size());
+      const auto view_tail = prefix_match<prefix>(string_view{str, size});
+      CHECK(view_tail.has_value() == match);
+      if (match) CHECK(view_tail->data() == str + prefix.size());
+    }
+  }
+  munmap(page, 8192);
+
+  static_assert(prefix_match<prefix>("/api/v1/users/profile/settings/a"));
+  static_assert(!prefix_match<prefix>(string_view{"/api/v1/users/profile"}));
+}
+
+SCENARIO("Static Radix Tree: String View Visit and Traverse") {
+  // Tokens are looked up directly inside a larger buffer.
+  const string_view buffer = "help-me check verbose mine hel versions";
+  const string_view tokens[] = {buffer.substr(0, 7),  buffer.substr(8, 5),
+                                buffer.substr(14, 7), buffer.substr(22, 4),
+                                buffer.substr(27, 3), buffer.substr(31, 8)};
+  for (auto token : tokens) {
+    const string str{token};
+    string visited{};
+    string view_visited{};
+    const auto found = srt::visit<tree>(
+        str.c_str(), [&]<static_zstring s> { visited = s.data(); });
+    const auto view_found = srt::visit<tree>(
+        token, [&]<static_zstring s> { view_visited = s.data(); });
+    CHECK(found == view_found);
+    CHECK(visited == view_visited);
+  }
+
+  string_view input = "helpme";
+  string matched{};
+  string_view tail{};
+  auto size = srt::traverse<tree>(input, [&]<static_zstring s>(string_view t) {
+    matched = s.data();
+    tail = t;
+  });
+  REQUIRE(size);
+  CHECK(*size == 4);
+  CHECK(matched == "help");
+  CHECK(tail == "me");
+  CHECK(tail.data() == input.data() + 4);
+
+  size = srt::traverse<tree>(string_view{"xyz"}, []<static_zstring>(auto) {});
+  CHECK(!size);
+  size = srt::traverse<tree>(string_view{"keys"}, []<static_zstring>(auto) {});
+  CHECK(size == 3);
+}
+
+SCENARIO("Static Radix Tree: Flattening") {
+  constexpr auto& flat = srt::flattening<tree>;
+  static_assert(flat.nodes.size() == 20);
+  static_assert(flat.find("help-me") == 6);
+  static_assert(flat.find("he") == flat.npos);
+
+  size_t index = 0;
+  meta::value_list::for_each<srt::leaves<tree>>([&]<static_zstring str> {
+    CHECK(flat.find(str.data()) == index++);
+  });
+  for (auto str : {"", "h", "helpme", "help-", "abcd", "versio", "outputs"})
+    CHECK(flat.find(str) == flat.npos);
+}
+
+SCENARIO("Static Radix Tree: Matching Policies") {
+  using srt::ascii_case_insensitive;
+  using srt::detail::prefix_match;
+  using headers = srt::construction<"content-length", "content-type",
+                                    "connection", "host", "x-request-id">;
+
+  const auto visited = [](auto str, auto policy) {
+    string result{};
+    srt::visit<headers>(
+        str, [&]<static_zstring s> { result = s.data(); }, policy);
+    return result;
+  };
+  for (auto policy : {0, 1}) {
+    const auto check = [&](auto str, string_view expected) {
+      if (policy)
+        CHECK(visited(str, ascii_case_insensitive{}) == expected);
+      else
+        CHECK(visited(str, srt::case_sensitive{}) == "");
+    };
+    check("Content-Length", "content-length");
+    check(string_view{"CONTENT-TYPE;"}.substr(0, 12), "content-type");
+    check("X-Request-ID", "x-request-id");
+  }
+  CHECK(visited("content-lengtH", ascii_case_insensitive{}) ==
+        "content-length");
+  CHECK(visited("content_length", ascii_case_insensitive{}) == "");
+
+  // Long prefixes are compared by chunks with masks.
+  constexpr static_zstring prefix = "/API/v1/Users/profile[0]";
+  const string upper = "/api/V1/USERS/PROFILE[0]/tail";
+  CHECK(prefix_match<prefix>(upper.c_str(), ascii_case_insensitive{}) ==
+        upper.c_str() + prefix.size());
+  CHECK(!prefix_match<prefix>(upper.c_str()));
+  CHECK(!prefix_match<prefix>("/api/v1/users/profile{0}/tail",
+                              ascii_case_insensitive{}));
+  CHECK(!prefix_match<prefix>("/api/v1/users/profile[0",
+                              ascii_case_insensitive{}));
+  CHECK(*prefix_match<prefix>(string_view{upper}, ascii_case_insensitive{}) ==
+        "/tail");
+  static_assert(prefix_match<prefix>("/api/v1/users/profile[0]",
+                                     ascii_case_insensitive{}));
+
+  // Custom byte mappings are given by constexpr function objects.
+  using separators =
+      srt::byte_mapping<[](char c) { return (c == '_') ? '-' : c; }>;
+  CHECK(visited("content_length", separators{}) == "content-length");
+  CHECK(visited("x_request-id", separators{}) == "x-request-id");
+  CHECK(visited("Content_Length", separators{}) == "");
+  size_t matched = 0;
+  CHECK(srt::traverse<headers>(
+      "HOST:localhost",
+      [&]<static_zstring s>(czstring tail) {
+        CHECK(s == "host"_sz);
+        matched = string_view{tail}.size();
+      },
+      ascii_case_insensitive{}));
+  CHECK(matched == 10);
+}
+
+SCENARIO("Static Radix Tree: Batch Visit") {
+  vector<string> strs{};
+  meta::value_list::for_each<srt::leaves<tree>>(
+      [&]<static_zstring str> { strs.emplace_back(str.data()); });
+  const auto keys = strs.size();
+  for (size_t i = 0; i < keys; ++i)
+    strs.push_back(strs[i] + "x");
+  strs.push_back("");
+  strs.push_back("he");
+
+  const vector<string_view> views(strs.begin(), strs.end());
+  vector<size_t> indices(views.size());
+  srt::visit_all<tree>(views, indices);
+  for (size_t i = 0; i < views.size(); ++i)
+    CHECK(indices[i] == srt::flattening<tree>.find(views[i]));
+  for (size_t i = 0; i < keys; ++i)
+    CHECK(indices[i] == i);
+  CHECK(indices.back() == srt::npos);
+}
+
+SCENARIO("Static Radix Tree: Child Dispatch") {
+  // The root has more children than the dispatch threshold
+  // such that children are chosen by a table of their first characters.
+  using keywords =
+      srt::construction<"and", "break", "continue", "do", "else", "for", "if",
+                        "in", "nil", "or", "return", "then", "while">;
+  const auto visited = [](auto str, auto policy) {
+    string result{};
+    srt::visit<keywords>(
+        str, [&]<static_zstring s> { result = s.data(); }, policy);
+    return result;
+  };
+  for (auto key : {"and", "break", "continue", "do", "else", "for", "if",
+                   "in", "nil", "or", "return", "then", "while"}) {
+    CHECK(visited(key, srt::case_sensitive{}) == key);
+    CHECK(visited(string_view{key}, srt::case_sensitive{}) == key);
+  }
+  CHECK(visited("", srt::case_sensitive{}) == "");
+  CHECK(visited("x", srt::case_sensitive{}) == "");
+  CHECK(visited("\xff", srt::case_sensitive{}) == "");
+  CHECK(visited("While", srt::case_sensitive{}) == "");
+  CHECK(visited("While", srt::ascii_case_insensitive{}) == "while");
+  CHECK(visited(string_view{"RETURN"}, srt::ascii_case_insensitive{}) ==
+        "return");
+
+  size_t matched = 0;
+  CHECK(srt::traverse<keywords>("info", [&]<static_zstring s>(czstring tail) {
+    CHECK(s == "in"_sz);
+    matched = string_view{tail}.size();
+  }));
+  CHECK(matched == 2);
+  CHECK(!srt::traverse<keywords>("", []<static_zstring>(czstring) {}));
+  CHECK(srt::traverse<keywords>(string_view{"Done"},
+                                []<static_zstring s>(string_view) {},
+                                srt::ascii_case_insensitive{}) == 2);
+  CHECK(!srt::traverse<keywords>(string_view{"x"},
+                                 []<static_zstring>(string_view) {}));
+  static_assert(srt::visit<keywords>("then", []<static_zstring> {}));
+  static_assert(!srt::visit<keywords>("than", []<static_zstring> {}));
+
+  // The first characters of two children are equal under the policy.
+  // Both of them have to be reachable.
+  using folded = srt::construction<"Hxy", "hab", "a", "b", "c", "d">;
+  const auto folded_visited = [](string_view str, auto policy) {
+    string result{};
+    srt::visit<folded>(
+        str, [&]<static_zstring s> { result = s.data(); }, policy);
+    return result;
+  };
+  for (auto key : {"Hxy", "hab", "a", "b", "c", "d"}) {
+    CHECK(folded_visited(key, srt::ascii_case_insensitive{}) == key);
+    CHECK(folded_visited(key, srt::case_sensitive{}) == key);
+  }
+  CHECK(folded_visited("HAB", srt::ascii_case_insensitive{}) == "hab");
+  CHECK(folded_visited("hxy", srt::ascii_case_insensitive{}) == "Hxy");
+  CHECK(srt::traverse<folded>(string_view{"habit"},
+                              []<static_zstring s>(string_view) {
+                                CHECK(s == "hab"_sz);
+                              },
+                              srt::ascii_case_insensitive{}) == 3);
+  using dashes = srt::byte_mapping<[](char c) { return (c == '-') ? '_' : c; }>;
+  using mapped = srt::construction<"-x", "_y", "a", "b", "c", "d">;
+  CHECK(srt::visit<mapped>("-y", []<static_zstring s> { CHECK(s == "_y"_sz); },
+                           dashes{}));
+  CHECK(srt::visit<mapped>("_x", []<static_zstring s> { CHECK(s == "-x"_sz); },
+                           dashes{}));
+}
+
+SCENARIO("Static Radix Tree: Sorted Construction") {
+  // The construction has to result in the same types
+  // as inserting the strings one after another into an empty tree.
+  const auto same = []<static_zstring... str> {
+    return meta::equal<srt::construction<str...>,
+                       srt::insertion<srt::node<"">, str...>>;
+  };
+  static_assert(same.template operator()<>());
+  static_assert(same.template operator()<"">());
+  static_assert(same.template operator()<"abc", "ab", "", "abd", "abc", "b",
+                                         "\xff", "\x7f", "a">());
+  static_assert(same.template operator()<"key", "keyboard", "keys", "kes",
+                                         "keyboards", "k", "mouse", "mice">());
+  static_assert(same.template operator()<"GET", "POST", "PUT", "PATCH",
+                                         "DELETE", "HEAD", "OPTIONS">());
+
+  using tree = srt::construction<"lion", "lynx", "lizard", "li", "lion">;
+  CHECK(srt::leaf_count<tree> == 4);
+  CHECK(srt::visit<tree>("lizard", []<static_zstring> {}));
+  CHECK(!srt::visit<tree>("l", []<static_zstring> {}));
+}
+
+SCENARIO("Static Radix Tree: Leaf Payloads") {
+  using srt::node_list;
+  using srt::value;
+  enum class method { get, head, post, put, patch };
+  using methods = srt::map_construction<leaf<"GET", value<method::get>>,
+                                        leaf<"HEAD", value<method::head>>,
+                                        leaf<"POST", value<method::post>>,
+                                        leaf<"PUT", value<method::put>>,
+                                        leaf<"PATCH", value<method::patch>>,
+                                        leaf<"GET", value<method::post>>>;
+
+  // The structure is the same as for the plain construction.
+  using manual =
+      node<"", node_list<leaf<"GET", value<method::get>>,
+                         leaf<"HEAD", value<method::head>>,
+                         node<"P", node_list<leaf<"ATCH", value<method::patch>>,
+                                             leaf<"OST", value<method::post>>,
+                                             leaf<"UT", value<method::put>>>>>>;
+  static_assert(meta::equal<methods, manual>);
+  static_assert(srt::leaf_count<methods> == 5);
+  static_assert(meta::equal<srt::value_type<methods>, method>);
+
+  CHECK(srt::find<methods>("GET") == method::get);
+  CHECK(srt::find<methods>("PATCH") == method::patch);
+  CHECK(srt::find<methods>(string_view{"PUTS"}.substr(0, 3)) == method::put);
+  CHECK(!srt::find<methods>("P"));
+  CHECK(!srt::find<methods>("PUTS"));
+  CHECK(!srt::find<methods>(""));
+  static_assert(srt::find<methods>("HEAD") == method::head);
+  CHECK(srt::leaf_index<methods>("POST") == 3);
+  CHECK(srt::leaf_index<methods>("DELETE") == srt::npos);
+
+  // Inserting strings keeps the payloads of existing leaves.
+  using extended = srt::insertion<methods, "PATCHES", "PU", "GE">;
+  static_assert(meta::equal<element<srt::payloads<extended>, 0>, void>);
+  static_assert(
+      meta::equal<element<srt::payloads<extended>, 1>, value<method::get>>);
+  static_assert(
+      meta::equal<element<srt::payloads<extended>, 3>, value<method::patch>>);
+  static_assert(meta::equal<element<srt::payloads<extended>, 4>, void>);
+  static_assert(meta::equal<element<srt::payloads<extended>, 6>, void>);
+  static_assert(
+      meta::equal<element<srt::payloads<extended>, 7>, value<method::put>>);
+
+  // Payloads may be arbitrary types.
+  using types = srt::map_construction<leaf<"int", int>, leaf<"float", float>>;
+  static_assert(meta::equal<srt::payloads<types>, type_list<float, int>>);
+  CHECK(srt::visit<types>("int", []<static_zstring> {}));
+}
@@ -0,0 +1,71 @@
+#include <doctest/doctest.h>
+//
+#include <string>
+//
+#include <lyrahgames/xstd/string_hash.hpp>
+
+using namespace std;
+using namespace lyrahgames::xstd;
+
+// Reference values of the original implementations.
+static_assert(fnv1a("") == 0xcbf29ce484222325ull);
+static_assert(fnv1a("a"_sz) == 0xaf63dc4c8601ec8cull);
+static_assert(wyhash("", 0) == 0x0409638ee2bde459ull);
+static_assert(wyhash("a", 1) == 0xa8412d091b5fe0a9ull);
+static_assert(wyhash("abc", 2) == 0x32dd92e4b2915153ull);
+static_assert(wyhash("message digest", 3) == 0x8619124089a3a16bull);
+static_assert(wyhash("abcdefghijklmnopqrstuvwxyz", 4) == 0x7a43afb61d7f5f40ull);
+static_assert(wyhash("ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz"
+                     "0123456789",
+                     5) == 0xff42329b90e50d58ull);
+static_assert(wyhash("123456789012345678901234567890123456789012345678901234567"
+                     "89012345678901234567890",
+                     6) == 0xc39cab13b115aad3ull);
+static_assert(xxh3("") == 0x2d06800538d394c2ull);
+static_assert(xxh3("a", 42) == 0x4c437dd47f0716f4ull);
+static_assert(xxh3("abc"_sz) == 0x78af5f94892f3950ull);
+static_assert(xxh3("message digest") == 0x160d8e9329be94f9ull);
+static_assert(xxh3("abcdefghijklmnopqrstuvwxyz", 42) == 0xab54ab387a929d0eull);
+static_assert(xxh3("123456789012345678901234567890123456789012345678901234567"
+                   "89012345678901234567890") == 0x7f58aa2520c681f9ull);
+
+namespace {
+
+// Strings of all sizes up to a few hundred bytes reach all code paths.
+// Their hashes are computed at compile time and compared at runtime.
+constexpr size_t max_size = 600;
+
+constexpr auto text = [] {
+  array<char, max_size> result{};
+  for (size_t i = 0; i < max_size; ++i)
+    result[i] = static_cast<char>(i * 101 + 37);
+  return result;
+}();
+
+template <auto hash>
+constexpr auto static_hashes = [] {
+  array<uint64, max_size + 1> result{};
+  for (size_t n = 0; n <= max_size; ++n)
+    result[n] = hash(string_view{text.data(), n});
+  return result;
+}();
+
+}  // namespace
+
+SCENARIO("String Hash: Compile Time and Runtime Hashes are Identical") {
+  const string str(text.begin(), text.end());
+  constexpr auto fnv = [](string_view s) { return fnv1a(s); };
+  constexpr auto wy = [](string_view s) { return wyhash(s, 7); };
+  constexpr auto xxh = [](string_view s) { return xxh3(s); };
+  constexpr auto xxh_seeded = [](string_view s) { return xxh3(s, 7); };
+  for (size_t n = 0; n <= max_size; ++n) {
+    // Strings are not aligned and contain arbitrary bytes.
+    const auto s = string_view{str}.substr(0, n);
+    CHECK(fnv1a(s) == static_hashes<fnv>[n]);
+    CHECK(wyhash(s, 7) == static_hashes<wy>[n]);
+    CHECK(xxh3(s) == static_hashes<xxh>[n]);
+    CHECK(xxh3(s, 7) == static_hashes<xxh_seeded>[n]);
+  }
+  CHECK(xxh3(string(300, 'x')) == 0xa5d1b4607dc83554ull);
+  CHECK(xxh3(string(300, 'x'), 42) == 0x3d7bd01799f47492ull);
+}
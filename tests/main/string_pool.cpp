@@ -0,0 +1,77 @@
+#include <doctest/doctest.h>
+//
+#include <string>
+#include <thread>
+#include <unordered_set>
+#include <vector>
+//
+#include <lyrahgames/xstd/string_pool.hpp>
+
+using namespace std;
+using namespace lyrahgames::xstd;
+
+SCENARIO("String Pool: Interning") {
+  using pool_type = string_pool<"if", "else", "while", "">;
+  static_assert(pool_type::id<"if"> == string_id{0});
+  static_assert(pool_type::id<"while"> == string_id{2});
+
+  pool_type pool{};
+  CHECK(pool.size() == 4);
+  CHECK(pool.intern("else") == pool_type::id<"else">);
+  CHECK(pool.intern(string{"while"}) == pool_type::id<"while">);
+  CHECK(pool.intern("") == pool_type::id<"">);
+  CHECK(pool.view(pool_type::id<"if">) == "if");
+  CHECK(pool.size() == 4);
+
+  CHECK(!pool.find("for"));
+  const auto id = pool.intern("for");
+  CHECK(id == string_id{4});
+  CHECK(pool.find("for") == id);
+  CHECK(pool.intern(string{"for"}) == id);
+  CHECK(pool.intern("fo") != id);
+  CHECK(pool.view(id) == "for");
+  CHECK(pool.view(id).data()[3] == '\0');
+  CHECK(pool.size() == 6);
+
+  // Large strings and many strings force new blocks and growing tables.
+  const string large(100'000, 'x');
+  const auto large_id = pool.intern(large);
+  CHECK(pool.view(large_id) == large);
+  vector<string_id> ids{};
+  for (size_t i = 0; i < 10'000; ++i)
+    ids.push_back(pool.intern("identifier_" + to_string(i)));
+  for (size_t i = 0; i < ids.size(); ++i) {
+    CHECK(pool.view(ids[i]) == "identifier_" + to_string(i));
+    CHECK(pool.intern("identifier_" + to_string(i)) == ids[i]);
+  }
+  CHECK(pool.size() == 6 + 1 + ids.size());
+  CHECK(unordered_set<string_id>(ids.begin(), ids.end()).size() == ids.size());
+}
+
+SCENARIO("String Pool: Concurrent Interning") {
+  string_pool<"shared"> pool{};
+  constexpr size_t thread_count = 8;
+  constexpr size_t string_count = 4096;
+  // All threads intern the same strings in different orders
+  // given by odd multipliers modulo a power of two.
+  vector<vector<string_id>> ids(thread_count);
+  vector<thread> threads{};
+  for (size_t t = 0; t < thread_count; ++t)
+    threads.emplace_back([&, t] {
+      auto& result = ids[t];
+      result.resize(string_count);
+      for (size_t j = 0; j < string_count; ++j) {
+        const auto i = (j * (2 * t + 1) + t) % string_count;
+        result[i] = pool.intern("name_" + to_string(i));
+        pool.intern("shared");
+      }
+    });
+  for (auto& t : threads)
+    t.join();
+
+  CHECK(pool.size() == 1 + string_count);
+  for (size_t t = 1; t < thread_count; ++t)
+    CHECK(ids[t] == ids[0]);
+  for (size_t i = 0; i < string_count; ++i)
+    CHECK(pool.view(ids[0][i]) == "name_" + to_string(i));
+}
@@ -0,0 +1,62 @@
+#include <doctest/doctest.h>
+//
+#include <string>
+//
+#include <lyrahgames/xstd/string_switch.hpp>
+
+using namespace std;
+using namespace lyrahgames::xstd;
+
+namespace {
+
+using command = string_switch<"help", "version", "quit", "", "run", "runs">;
+
+constexpr auto execute(string_view str) {
+  switch (command::index(str)) {
+    case command::case_of<"help">:
+      return 1;
+    case command::case_of<"version">:
+      return 2;
+    case command::case_of<"quit">:
+      return 3;
+    case command::case_of<"">:
+      return 4;
+    case command::case_of<"run">:
+    case command::case_of<"runs">:
+      return 5;
+    case command::npos:
+      return 0;
+  }
+  return -1;
+}
+
+}  // namespace
+
+static_assert(command::case_of<"quit"> == 2);
+static_assert(execute("version") == 2);
+static_assert(execute("versions") == 0);
+
+SCENARIO("String Switch") {
+  CHECK(execute("help") == 1);
+  CHECK(execute(string{"version"}) == 2);
+  CHECK(execute("quit") == 3);
+  CHECK(execute("") == 4);
+  CHECK(execute("run") == 5);
+  CHECK(execute("runs") == 5);
+  CHECK(execute("Help") == 0);
+  CHECK(execute("hel") == 0);
+  CHECK(execute("helpme") == 0);
+
+  string visited{};
+  CHECK(command::visit("runs", [&]<static_zstring str> { visited = str; }));
+  CHECK(visited == "runs");
+  CHECK(!command::visit("walk", [&]<static_zstring str> { visited = str; }));
+  CHECK(visited == "runs");
+
+  // Many cases still result in small tables.
+  using digits = string_switch<"zero", "one", "two", "three", "four", "five",
+                               "six", "seven", "eight", "nine">;
+  CHECK(digits::table.size() <= 64);
+  CHECK(digits::index("seven") == 7);
+  CHECK(digits::index("ten") == digits::npos);
+}
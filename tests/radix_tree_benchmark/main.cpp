@@ -0,0 +1,129 @@
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <random>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+//
+#include <lyrahgames/xstd/chrono.hpp>
+#include <lyrahgames/xstd/radix_tree.hpp>
+
+using namespace std;
+using namespace lyrahgames;
+using namespace xstd;
+
+namespace {
+
+// Heterogeneous lookup for 'std::unordered_map' with string keys.
+struct string_hash {
+  using is_transparent = void;
+  auto operator()(string_view str) const noexcept {
+    return hash<string_view>{}(str);
+  }
+};
+
+using hash_map = unordered_map<string, size_t, string_hash, equal_to<>>;
+using ordered_map = map<string, size_t, less<>>;
+
+// Generate routes like '/api/v2/projects/issues/list'
+// which share long prefixes as in typical routing tables.
+auto generate_routes(size_t count, mt19937& rng) {
+  static constexpr string_view segments[] = {
+      "api",      "v1",       "v2",     "users",   "groups",   "projects",
+      "issues",   "comments", "labels", "commits", "branches", "settings",
+      "list",     "create",   "read",   "update",  "delete",   "search",
+      "archive",  "export",   "import", "history", "members",  "hooks",
+      "packages", "jobs",     "tags",   "assets",  "wikis",    "keys"};
+  uniform_int_distribution<size_t> segment{0, size(segments) - 1};
+  uniform_int_distribution<size_t> depth{1, 6};
+  vector<string> routes{};
+  routes.reserve(count);
+  while (routes.size() < count) {
+    string route{};
+    for (auto n = depth(rng); n > 0; --n)
+      (route += '/') += segments[segment(rng)];
+    routes.push_back(move(route));
+  }
+  return routes;
+}
+
+// Print the median time per query together with the sum of all results
+// such that all variants can be cross-checked.
+void print(string_view name, const auto& result, size_t count, size_t sum) {
+  const auto time = result.median() / count;
+  cout << setw(30) << name << " = " << setw(10)
+       << chrono::duration<float64, nano>(time).count() << " ns/query"
+       << setw(14) << sum << " sum\n";
+}
+
+void run(string_view name, const vector<string>& queries, auto&& query) {
+  size_t sum = 0;
+  const auto result = benchmark([&] {
+    sum = 0;
+    for (const auto& q : queries)
+      sum += query(q);
+    return sum;
+  });
+  print(name, result, queries.size(), sum);
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  const size_t route_count = (argc > 1) ? stoul(argv[1]) : 10'000;
+  const size_t query_count = (argc > 2) ? stoul(argv[2]) : 10'000;
+
+  mt19937 rng{random_device{}()};
+  const auto routes = generate_routes(route_count, rng);
+
+  radix_tree<size_t> tree{};
+  hash_map hashes{};
+  ordered_map ordered{};
+  for (size_t i = 0; i < routes.size(); ++i) {
+    tree.insert(routes[i], i);
+    hashes.emplace(routes[i], i);
+    ordered.emplace(routes[i], i);
+  }
+  cout << "routes = " << tree.size() << ", nodes = " << tree.nodes_.size()
+       << '\n';
+
+  // Lookups of known and unknown routes.
+  const auto queries = generate_routes(query_count, rng);
+  cout << "lookup:\n";
+  run("radix_tree.find", queries, [&](string_view q) {
+    const auto value = tree.find(q);
+    return value ? *value : 0;
+  });
+  run("unordered_map.find", queries, [&](string_view q) {
+    const auto it = hashes.find(q);
+    return (it != hashes.end()) ? it->second : 0;
+  });
+  run("map.find", queries, [&](string_view q) {
+    const auto it = ordered.find(q);
+    return (it != ordered.end()) ? it->second : 0;
+  });
+
+  // Longest-prefix queries of routes with request-specific suffixes.
+  auto requests = generate_routes(query_count, rng);
+  for (auto& request : requests)
+    request += "/1234/details";
+  cout << "longest prefix:\n";
+  run("radix_tree.longest_prefix", requests, [&](string_view q) {
+    return tree.longest_prefix(q).first;
+  });
+  // The maps have to check every prefix that ends at a segment boundary.
+  const auto longest_prefix = [](const auto& map, string_view q) -> size_t {
+    for (auto size = q.size(); size != string_view::npos;
+         size = q.rfind('/', size - 1)) {
+      if (map.contains(q.substr(0, size))) return size;
+      if (size == 0) break;
+    }
+    return 0;
+  };
+  run("unordered_map (per segment)", requests,
+      [&](string_view q) { return longest_prefix(hashes, q); });
+  run("map (per segment)", requests,
+      [&](string_view q) { return longest_prefix(ordered, q); });
+}
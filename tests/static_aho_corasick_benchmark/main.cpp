@@ -0,0 +1,86 @@
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <string_view>
+//
+#include <lyrahgames/xstd/chrono.hpp>
+#include <lyrahgames/xstd/static_aho_corasick.hpp>
+
+using namespace std;
+using namespace lyrahgames;
+using namespace xstd;
+
+namespace {
+
+using automaton = static_aho_corasick<"ERROR",
+                                      "WARNING",
+                                      "FATAL",
+                                      "timeout",
+                                      "connection refused",
+                                      "segmentation fault",
+                                      "out of memory",
+                                      "permission denied",
+                                      "deadlock",
+                                      "retrying",
+                                      "panic",
+                                      "assertion failed">;
+
+// Generate log lines of random words
+// in which some of the keys are spread.
+auto generate_log(size_t mebibytes) {
+  static constexpr string_view words[] = {
+      "INFO",    "DEBUG",    "request", "user",    "handled", "in",
+      "ms",      "session",  "started", "stopped", "worker",  "queue",
+      "GET",     "/api/v1/", "status",  "200",     "cache",   "miss"};
+  mt19937 rng{random_device{}()};
+  uniform_int_distribution<size_t> word{0, size(words) - 1};
+  uniform_int_distribution<size_t> key{0, automaton::key_count - 1};
+  uniform_int_distribution<size_t> length{4, 16};
+  string log{};
+  log.reserve(mebibytes << 20);
+  while (log.size() < (mebibytes << 20)) {
+    for (auto n = length(rng); n > 0; --n)
+      (log += words[word(rng)]) += ' ';
+    if (rng() % 8 == 0) log += automaton::strings[key(rng)];
+    log += '\n';
+  }
+  return log;
+}
+
+void print(string_view name, auto time, size_t bytes, size_t matches) {
+  cout << setw(30) << name << " = " << setw(10) << time.count() << " s"
+       << setw(10) << bytes / time.count() / (1 << 30) << " GiB/s"
+       << setw(12) << matches << " matches\n";
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  const size_t mebibytes = (argc > 1) ? stoul(argv[1]) : 64;
+  const size_t chunk_size = (argc > 2) ? stoul(argv[2]) : (64 << 10);
+  const auto log = generate_log(mebibytes);
+
+  {
+    size_t matches = 0;
+    const auto time = duration([&] {
+      automaton::scanner scanner{};
+      for (size_t i = 0; i < log.size(); i += chunk_size)
+        scanner.scan(string_view{log}.substr(i, chunk_size),
+                     [&](size_t, size_t) { ++matches; });
+    });
+    print("static_aho_corasick", time, log.size(), matches);
+  }
+
+  // The baseline searches every key separately.
+  {
+    size_t matches = 0;
+    const auto time = duration([&] {
+      for (auto key : automaton::strings)
+        for (auto i = log.find(key); i != string::npos;
+             i = log.find(key, i + 1))
+          ++matches;
+    });
+    print("string::find per key", time, log.size(), matches);
+  }
+}
@@ -0,0 +1,1024 @@
+"/api/v1/labels/export",
+"znwhqujoa_members",
+"/api/v2/notifications/search",
+"/api/v3/runners/pause",
+"/api/v2/keys/transfer",
+"yampdbir_branches",
+"/api/v3/milestones/resume",
+"/api/v1/keys/permissions",
+"/api/v3/hooks/unsubscribe",
+"/api/v1/milestones/history",
+"edzy-statistics",
+"/api/v2/releases/import",
+"/api/v2/runners/preview",
+"/api/v3/wikis/create",
+"/api/v2/commits/subscribe",
+"/api/v1/pipelines/list",
+"/api/v2/branches/restore",
+"/api/v2/settings/watch",
+"hpfrtxafko-watch",
+"/api/v2/tags/unsubscribe",
+"/api/v3/keys/pause",
+"/api/v2/notifications/update",
+"/api/v2/labels/permissions",
+"/api/v3/repositories/star",
+"/api/v2/keys/merge",
+"/api/v3/deployments/archive",
+"/api/v2/packages/read",
+"/api/v2/releases/retry",
+"/api/v1/packages/star",
+"/api/v3/repositories/unsubscribe",
+"/api/v2/packages/archive",
+"/api/v2/invitations/download",
+"/api/v3/hooks/archive",
+"/api/v3/tags/sync",
+"/api/v2/hooks/retry",
+"/api/v1/hooks/preview",
+"gupzdkgk_releases",
+"pjtxaznanqy-archive",
+"/api/v3/invitations/subscribe",
+"/api/v1/deployments/permissions",
+"/api/v1/jobs/list",
+"/api/v2/secrets/delete",
+"/api/v3/deployments/statistics",
+"/api/v2/members/cancel",
+"nsjseg",
+"dmjnfb_assets",
+"/api/v3/hooks/merge",
+"/api/v2/deployments/cancel",
+"ijusvkxaxbh_notifications",
+"/api/v2/repositories/restore",
+"/api/v3/snippets/read",
+"/api/v1/groups/update",
+"/api/v3/users/watch",
+"/api/v3/pipelines/transfer",
+"/api/v1/tags/retry",
+"jtbvmo_members",
+"/api/v1/groups/merge",
+"/api/v2/assets/unsubscribe",
+"/api/v2/runners/retry",
+"/api/v2/assets/statistics",
+"/api/v2/environments/subscribe",
+"anx",
+"/api/v3/projects/list",
+"/api/v3/users/merge",
+"/api/v1/invitations/archive",
+"/api/v1/runners/import",
+"/api/v1/deployments/search",
+"/api/v1/settings/update",
+"/api/v2/projects/reject",
+"/api/v3/issues/download",
+"/api/v1/issues/subscribe",
+"/api/v1/wikis/lock",
+"/api/v3/users/cancel",
+"/api/v2/members/watch",
+"/api/v3/pipelines/validate",
+"/api/v3/deployments/retry",
+"/api/v1/notifications/cancel",
+"/api/v3/pipelines/pause",
+"/api/v3/invitations/star",
+"/api/v3/tags/approve",
+"rab",
+"gqvahenmy",
+"/api/v2/milestones/delete",
+"/api/v3/projects/delete",
+"silixig",
+"/api/v2/branches/export",
+"/api/v2/jobs/download",
+"/api/v1/pipelines/cancel",
+"/api/v1/jobs/search",
+"/api/v1/comments/delete",
+"/api/v1/variables/retry",
+"prr-merge",
+"/api/v1/billing/resume",
+"/api/v1/commits/read",
+"/api/v3/groups/unsubscribe",
+"yzl_deployments",
+"/api/v3/keys/list",
+"/api/v3/releases/read",
+"/api/v3/repositories/download",
+"/api/v2/milestones/lock",
+"/api/v3/artifacts/restore",
+"/api/v1/variables/validate",
+"/api/v3/groups/approve",
+"/api/v3/snippets/list",
+"/api/v1/assets/upload",
+"/api/v2/billing/archive",
+"nnvcfulu_groups",
+"/api/v3/packages/statistics",
+"/api/v3/repositories/read",
+"/api/v1/keys/reject",
+"/api/v1/groups/search",
+"/api/v1/notifications/pause",
+"/api/v1/billing/reject",
+"/api/v2/issues/cancel",
+"/api/v1/users/delete",
+"/api/v3/milestones/list",
+"/api/v3/notifications/history",
+"/api/v3/comments/watch",
+"/api/v1/secrets/resume",
+"pslqi",
+"/api/v2/projects/create",
+"/api/v1/settings/delete",
+"/api/v2/labels/create",
+"/api/v1/pipelines/import",
+"/api/v2/hooks/list",
+"/api/v1/teams/merge",
+"usbpsqbdyzns",
+"/api/v2/invitations/permissions",
+"/api/v2/releases/merge",
+"doqlzxzwlmz-search",
+"/api/v1/releases/update",
+"/api/v2/wikis/upload",
+"/api/v2/comments/validate",
+"/api/v1/projects/pause",
+"/api/v1/issues/approve",
+"/api/v1/pipelines/permissions",
+"/api/v1/commits/permissions",
+"/api/v1/projects/import",
+"ovra_members",
+"ahy",
+"/api/v2/pipelines/upload",
+"rwzzn-search",
+"dxtmfgwbf-retry",
+"jnoqctld-history",
+"zcy",
+"/api/v1/labels/lock",
+"/api/v2/packages/upload",
+"/api/v3/wikis/preview",
+"/api/v3/commits/update",
+"ryunvqpueah-history",
+"/api/v1/deployments/unlock",
+"/api/v2/keys/members",
+"/api/v3/runners/list",
+"/api/v1/tags/upload",
+"/api/v1/labels/sync",
+"/api/v1/settings/star",
+"/api/v3/invitations/merge",
+"/api/v3/issues/export",
+"/api/v2/projects/transfer",
+"/api/v2/wikis/download",
+"nugxannidkkn-history",
+"/api/v3/users/lock",
+"/api/v2/comments/create",
+"/api/v1/keys/search",
+"/api/v1/keys/export",
+"/api/v2/hooks/import",
+"/api/v1/issues/transfer",
+"rjcazom_download",
+"lpmxv-search",
+"/api/v3/teams/lock",
+"/api/v3/comments/lock",
+"uxnmbimmfw-history",
+"/api/v1/environments/delete",
+"/api/v3/teams/restore",
+"/api/v1/snippets/export",
+"/api/v2/hooks/watch",
+"/api/v2/branches/update",
+"/api/v3/labels/approve",
+"/api/v1/runners/approve",
+"/api/v3/runners/merge",
+"/api/v3/pipelines/members",
+"/api/v2/issues/validate",
+"/api/v2/deployments/download",
+"wxouzzs-history",
+"ctbq_members",
+"/api/v3/notifications/export",
+"/api/v2/branches/sync",
+"/api/v3/branches/members",
+"bififeq_members",
+"/api/v1/users/members",
+"/api/v3/hooks/unlock",
+"/api/v2/issues/merge",
+"pkovac-search",
+"/api/v2/notifications/validate",
+"/api/v2/notifications/archive",
+"hjf",
+"/api/v3/environments/archive",
+"lzslcmqk-retry",
+"/api/v1/snippets/retry",
+"/api/v2/packages/watch",
+"/api/v3/groups/archive",
+"/api/v1/packages/history",
+"/api/v1/deployments/restore",
+"/api/v3/branches/permissions",
+"ylhagmb_download",
+"/api/v1/invitations/export",
+"mcge_download",
+"ibmfopmpf",
+"/api/v2/groups/star",
+"whdkxjzgewmj",
+"/api/v2/invitations/import",
+"/api/v1/packages/lock",
+"/api/v2/settings/create",
+"/api/v3/variables/update",
+"/api/v2/groups/download",
+"/api/v2/billing/create",
+"/api/v3/environments/upload",
+"cftxwnqlf_download",
+"/api/v3/comments/unlock",
+"/api/v2/snippets/list",
+"ycdvylwnxzv_members",
+"/api/v2/issues/subscribe",
+"/api/v3/environments/resume",
+"/api/v3/packages/watch",
+"pprs",
+"/api/v2/comments/delete",
+"/api/v2/releases/export",
+"jokprizl_members",
+"/api/v1/environments/preview",
+"jrvrmkdr-search",
+"/api/v1/packages/read",
+"rpalhm_create",
+"/api/v2/snippets/upload",
+"/api/v2/deployments/resume",
+"/api/v1/pipelines/lock",
+"yhjcloutgnt-history",
+"/api/v2/pipelines/unlock",
+"/api/v1/commits/approve",
+"/api/v2/teams/lock",
+"wamwvo_download",
+"/api/v2/users/delete",
+"/api/v3/commits/list",
+"/api/v2/billing/read",
+"/api/v3/notifications/transfer",
+"/api/v1/runners/pause",
+"/api/v2/commits/import",
+"/api/v3/projects/restore",
+"trrlznopl-history",
+"/api/v2/variables/restore",
+"/api/v1/pipelines/export",
+"mnwitibw_create",
+"/api/v1/invitations/watch",
+"/api/v3/releases/permissions",
+"/api/v3/commits/watch",
+"/api/v2/teams/sync",
+"/api/v3/environments/read",
+"/api/v2/groups/subscribe",
+"/api/v1/branches/read",
+"euhiazauq_members",
+"/api/v2/issues/unlock",
+"gud",
+"/api/v3/releases/export",
+"/api/v2/tags/import",
+"/api/v3/projects/import",
+"/api/v1/tags/export",
+"/api/v1/packages/delete",
+"/api/v1/releases/transfer",
+"/api/v3/branches/list",
+"/api/v3/pipelines/read",
+"/api/v1/groups/lock",
+"/api/v3/environments/pause",
+"/api/v2/hooks/approve",
+"tclecqinfkkz_download",
+"/api/v3/hooks/export",
+"ckmvsurfz-history",
+"/api/v1/deployments/members",
+"/api/v2/projects/watch",
+"mnuvfpn-history",
+"/api/v3/pipelines/update",
+"ezek-search",
+"/api/v3/comments/transfer",
+"iiq_members",
+"bhinhyjqwbc-search",
+"/api/v1/projects/watch",
+"mljxxejb-search",
+"/api/v1/branches/pause",
+"udknxh-search",
+"/api/v1/releases/upload",
+"/api/v3/snippets/approve",
+"/api/v3/issues/watch",
+"ccbiujsybscd-retry",
+"/api/v2/comments/merge",
+"vfhwvpgp_members",
+"zeonzkawygo-search",
+"/api/v1/snippets/read",
+"ctswiqylf_download",
+"/api/v3/comments/delete",
+"/api/v2/branches/star",
+"nihynbtrmps_download",
+"/api/v2/users/read",
+"vxexgdp_create",
+"oljomdiffhto",
+"assmkwy_members",
+"qucfw_download",
+"ejdk_download",
+"/api/v1/notifications/lock",
+"/api/v2/issues/restore",
+"/api/v3/packages/validate",
+"nyap-retry",
+"/api/v3/users/read",
+"/api/v3/billing/validate",
+"/api/v1/variables/sync",
+"/api/v2/pipelines/subscribe",
+"/api/v1/releases/members",
+"/api/v2/teams/archive",
+"/api/v2/deployments/export",
+"/api/v1/snippets/create",
+"enjaev_members",
+"/api/v3/wikis/lock",
+"/api/v3/runners/download",
+"/api/v1/teams/approve",
+"/api/v2/branches/validate",
+"/api/v3/invitations/transfer",
+"/api/v2/notifications/permissions",
+"/api/v1/projects/create",
+"/api/v2/settings/delete",
+"/api/v2/notifications/sync",
+"/api/v3/comments/update",
+"/api/v2/invitations/read",
+"/api/v1/environments/restore",
+"huw-history",
+"zwdoxzcses",
+"/api/v2/wikis/history",
+"/api/v3/comments/retry",
+"/api/v1/labels/history",
+"qxzsjuexw_create",
+"/api/v1/commits/restore",
+"/api/v1/users/approve",
+"/api/v3/commits/export",
+"umtco_members",
+"/api/v3/labels/import",
+"/api/v3/billing/read",
+"xqc-retry",
+"/api/v2/snippets/resume",
+"/api/v3/pipelines/delete",
+"/api/v3/billing/watch",
+"/api/v2/runners/members",
+"/api/v3/deployments/history",
+"mtibxxq-retry",
+"/api/v1/comments/create",
+"/api/v3/runners/unlock",
+"/api/v3/projects/update",
+"wrptdaopmt-search",
+"/api/v2/branches/history",
+"/api/v2/branches/read",
+"/api/v2/snippets/restore",
+"/api/v2/runners/delete",
+"nkym_create",
+"/api/v3/users/create",
+"/api/v3/groups/restore",
+"/api/v1/projects/resume",
+"/api/v2/variables/sync",
+"bcinyqupuhbf-search",
+"/api/v1/branches/download",
+"/api/v3/packages/search",
+"/api/v2/wikis/merge",
+"/api/v1/groups/export",
+"jndwqomve_download",
+"/api/v2/commits/pause",
+"/api/v3/tags/permissions",
+"ksilqk_members",
+"/api/v2/comments/download",
+"ducif_download",
+"/api/v3/commits/search",
+"/api/v1/projects/members",
+"xdrvm",
+"/api/v2/wikis/import",
+"vlywjasgqu-history",
+"/api/v2/teams/resume",
+"/api/v2/projects/sync",
+"/api/v3/billing/resume",
+"/api/v2/keys/approve",
+"jla_download",
+"wex_download",
+"/api/v2/groups/resume",
+"/api/v2/invitations/transfer",
+"iacx_create",
+"/api/v1/notifications/approve",
+"pcpjowvnm-history",
+"/api/v3/releases/history",
+"/api/v1/notifications/resume",
+"myk_create",
+"ptkykpb-retry",
+"/api/v3/packages/archive",
+"/api/v1/projects/download",
+"hsplrs_create",
+"qfnneqm",
+"/api/v1/notifications/restore",
+"/api/v2/issues/create",
+"/api/v1/packages/merge",
+"/api/v3/wikis/search",
+"zxairlhgy_members",
+"/api/v2/users/upload",
+"/api/v1/branches/approve",
+"/api/v2/tags/sync",
+"/api/v1/tags/merge",
+"/api/v1/releases/preview",
+"/api/v3/snippets/watch",
+"wyzoiawwcip-search",
+"/api/v2/teams/preview",
+"/api/v1/pipelines/upload",
+"/api/v3/projects/merge",
+"/api/v2/deployments/validate",
+"zkwuleuamzs_create",
+"/api/v3/variables/download",
+"/api/v3/issues/unlock",
+"/api/v2/users/watch",
+"/api/v2/variables/upload",
+"gce-retry",
+"/api/v1/invitations/history",
+"wobjl-history",
+"/api/v2/projects/update",
+"/api/v3/branches/download",
+"/api/v2/branches/list",
+"nsxrunbhynx_download",
+"trswyrdofxl-search",
+"uhzmfrko-retry",
+"/api/v3/keys/star",
+"fgruiqwtffc-search",
+"/api/v3/variables/watch",
+"/api/v3/invitations/read",
+"/api/v1/snippets/preview",
+"/api/v1/comments/pause",
+"seftgrbp-history",
+"srh_download",
+"/api/v3/teams/resume",
+"vbljkwfz_create",
+"/api/v1/groups/validate",
+"/api/v2/billing/watch",
+"/api/v2/users/merge",
+"/api/v1/variables/star",
+"/api/v3/wikis/list",
+"djavckt-retry",
+"/api/v2/teams/members",
+"/api/v2/pipelines/history",
+"/api/v1/groups/preview",
+"djrsjzlhendx_members",
+"/api/v2/notifications/upload",
+"ppaaqqb-search",
+"pqcj-history",
+"yeajslmcdvsv",
+"jjvfdlio_create",
+"/api/v1/invitations/merge",
+"/api/v2/users/restore",
+"/api/v2/settings/preview",
+"hnohz-search",
+"/api/v3/users/restore",
+"/api/v2/labels/approve",
+"/api/v1/issues/delete",
+"/api/v2/projects/read",
+"/api/v1/wikis/list",
+"/api/v2/releases/star",
+"/api/v2/keys/create",
+"gnumhp",
+"/api/v2/users/transfer",
+"zwcmysqgcwr-history",
+"bcbk-history",
+"/api/v1/teams/import",
+"/api/v2/labels/star",
+"edgqpwae-history",
+"/api/v1/environments/archive",
+"lvbaekoeweb-retry",
+"/api/v2/projects/upload",
+"/api/v1/labels/members",
+"/api/v3/billing/list",
+"/api/v1/invitations/members",
+"/api/v1/runners/retry",
+"/api/v3/projects/export",
+"gtsvmbxfvd_members",
+"/api/v1/groups/members",
+"/api/v3/deployments/import",
+"/api/v2/variables/search",
+"/api/v1/labels/transfer",
+"/api/v1/teams/download",
+"gcckoq-history",
+"ollzlu_create",
+"/api/v1/variables/pause",
+"nrndukiwuklg_create",
+"/api/v1/variables/download",
+"skfgfkjoe-history",
+"/api/v1/pipelines/download",
+"gpvlqmnyvw_create",
+"/api/v2/notifications/pause",
+"/api/v3/commits/upload",
+"tdxfr-search",
+"/api/v2/comments/archive",
+"onicdy_members",
+"/api/v1/projects/update",
+"azktxksruhp_create",
+"pmcelc",
+"/api/v2/groups/history",
+"tnr-retry",
+"/api/v3/invitations/update",
+"/api/v3/invitations/watch",
+"/api/v3/hooks/validate",
+"xvboicowabq_download",
+"kyhblomgikb_members",
+"/api/v1/wikis/resume",
+"/api/v1/packages/watch",
+"/api/v2/labels/preview",
+"/api/v2/groups/transfer",
+"/api/v3/commits/read",
+"/api/v1/settings/watch",
+"/api/v1/notifications/transfer",
+"/api/v1/tags/watch",
+"mloi",
+"/api/v1/wikis/read",
+"dkcnkdwechq-history",
+"/api/v1/issues/history",
+"/api/v2/invitations/members",
+"/api/v2/deployments/search",
+"/api/v3/pipelines/export",
+"/api/v3/deployments/subscribe",
+"/api/v1/teams/create",
+"/api/v3/settings/create",
+"yslelrwc-search",
+"/api/v1/comments/transfer",
+"gnhw-retry",
+"/api/v2/keys/unlock",
+"/api/v1/invitations/import",
+"/api/v3/notifications/create",
+"/api/v2/projects/resume",
+"dgeydograku-retry",
+"/api/v2/comments/statistics",
+"/api/v2/commits/lock",
+"/api/v1/runners/validate",
+"lfkrzy_download",
+"/api/v1/releases/merge",
+"/api/v1/labels/preview",
+"bbngurggr-search",
+"/api/v3/keys/statistics",
+"/api/v1/teams/sync",
+"jcdxpqfmyxrk-retry",
+"/api/v3/deployments/validate",
+"/api/v1/labels/import",
+"/api/v1/hooks/lock",
+"/api/v1/keys/merge",
+"/api/v1/issues/download",
+"/api/v3/keys/subscribe",
+"/api/v1/packages/statistics",
+"/api/v3/billing/permissions",
+"/api/v3/projects/retry",
+"/api/v2/deployments/history",
+"/api/v3/billing/create",
+"/api/v3/snippets/merge",
+"/api/v2/hooks/search",
+"nyeakipaquy",
+"/api/v3/branches/update",
+"/api/v1/branches/star",
+"glmnwtmw-retry",
+"/api/v1/snippets/upload",
+"/api/v1/variables/permissions",
+"ranmooedl_members",
+"/api/v1/packages/validate",
+"/api/v1/snippets/sync",
+"/api/v2/hooks/preview",
+"/api/v3/environments/delete",
+"/api/v3/packages/retry",
+"/api/v1/variables/statistics",
+"/api/v2/tags/delete",
+"/api/v3/comments/statistics",
+"fvkafrxgqzk",
+"/api/v2/snippets/search",
+"/api/v3/groups/members",
+"/api/v1/teams/retry",
+"/api/v1/snippets/validate",
+"/api/v3/tags/download",
+"/api/v2/hooks/delete",
+"/api/v3/projects/read",
+"/api/v3/releases/pause",
+"/api/v1/groups/unlock",
+"cnqjgudrnj-search",
+"/api/v1/notifications/update",
+"/api/v1/tags/unlock",
+"/api/v1/groups/sync",
+"yww_members",
+"/api/v2/environments/upload",
+"zxhvhkjzb",
+"/api/v3/comments/approve",
+"slimttgzf",
+"zvclkoedzlv-retry",
+"hqtmanmzcbyv",
+"/api/v2/labels/list",
+"/api/v1/branches/subscribe",
+"/api/v3/notifications/watch",
+"adbfmzr_create",
+"peemg_members",
+"/api/v2/variables/archive",
+"fikm_download",
+"/api/v3/invitations/members",
+"acvsdqa_download",
+"/api/v2/environments/restore",
+"/api/v3/commits/pause",
+"/api/v1/environments/sync",
+"/api/v2/notifications/preview",
+"/api/v3/wikis/update",
+"hytchqz-retry",
+"/api/v3/releases/preview",
+"/api/v3/invitations/import",
+"/api/v3/tags/search",
+"whpgecniojb-search",
+"/api/v1/comments/watch",
+"gpdlrtaduss-search",
+"/api/v3/groups/export",
+"puwhulxt_create",
+"/api/v3/variables/restore",
+"amtjanwuehye_members",
+"/api/v2/environments/permissions",
+"/api/v1/commits/list",
+"/api/v3/labels/sync",
+"/api/v3/commits/transfer",
+"wxuoispobc_members",
+"brmxz",
+"/api/v1/branches/create",
+"/api/v2/snippets/members",
+"/api/v1/settings/merge",
+"/api/v1/comments/update",
+"/api/v2/packages/resume",
+"wgpxwbwv_members",
+"/api/v1/comments/upload",
+"/api/v3/groups/update",
+"/api/v3/snippets/download",
+"fynkusoqclh_create",
+"/api/v3/pipelines/lock",
+"/api/v3/runners/restore",
+"/api/v1/wikis/preview",
+"/api/v1/projects/lock",
+"xnswzjwmg-search",
+"hipsghjxin-retry",
+"kxeuchxz-history",
+"/api/v3/invitations/delete",
+"/api/v1/settings/read",
+"/api/v2/runners/read",
+"wesmtsegaip_members",
+"/api/v1/groups/retry",
+"/api/v3/snippets/members",
+"/api/v1/users/archive",
+"/api/v2/labels/history",
+"/api/v3/labels/search",
+"/api/v1/billing/update",
+"/api/v2/keys/search",
+"/api/v3/snippets/validate",
+"/api/v1/commits/sync",
+"/api/v2/environments/list",
+"aedurdgixuf_create",
+"/api/v2/commits/permissions",
+"/api/v2/keys/subscribe",
+"/api/v2/users/resume",
+"/api/v3/pipelines/list",
+"/api/v3/deployments/resume",
+"/api/v2/teams/create",
+"/api/v2/runners/watch",
+"/api/v2/issues/read",
+"vgsdjsvsjx-search",
+"/api/v1/billing/transfer",
+"iwaawgshly_members",
+"/api/v3/settings/sync",
+"/api/v2/packages/preview",
+"/api/v1/groups/star",
+"/api/v3/comments/history",
+"/api/v1/snippets/update",
+"/api/v3/variables/permissions",
+"/api/v3/tags/export",
+"/api/v3/releases/archive",
+"ffdjadywce-search",
+"/api/v2/packages/search",
+"/api/v2/variables/delete",
+"/api/v2/packages/subscribe",
+"/api/v1/projects/validate",
+"/api/v2/keys/download",
+"/api/v3/packages/subscribe",
+"/api/v2/releases/subscribe",
+"/api/v2/branches/download",
+"zghbqaoo-retry",
+"/api/v3/users/export",
+"phkza-search",
+"/api/v1/users/merge",
+"/api/v3/teams/download",
+"/api/v2/releases/approve",
+"/api/v2/groups/merge",
+"ztlqreivhcd-history",
+"dsxrj-search",
+"/api/v3/deployments/search",
+"/api/v1/releases/subscribe",
+"/api/v3/tags/retry",
+"/api/v2/environments/preview",
+"qmpjsivgfyr-search",
+"/api/v2/releases/unlock",
+"/api/v1/tags/subscribe",
+"dnkewnmrtm_download",
+"gwfqjzhw-retry",
+"jhwxp-history",
+"/api/v3/hooks/resume",
+"/api/v3/keys/history",
+"/api/v2/runners/lock",
+"wffdhrrx-retry",
+"ieqizmm-retry",
+"/api/v3/hooks/create",
+"/api/v2/tags/lock",
+"/api/v3/billing/transfer",
+"xzge",
+"/api/v2/issues/upload",
+"/api/v1/deployments/retry",
+"/api/v3/snippets/preview",
+"hsqrzanl_members",
+"/api/v2/tags/approve",
+"cgguecajxp-retry",
+"/api/v2/teams/restore",
+"/api/v2/tags/list",
+"/api/v3/tags/unlock",
+"wudvlt_create",
+"/api/v1/groups/pause",
+"/api/v3/runners/retry",
+"/api/v1/projects/statistics",
+"/api/v3/keys/sync",
+"/api/v3/settings/delete",
+"sqwzgbrst_download",
+"svw-history",
+"mkfeinduit",
+"/api/v2/environments/merge",
+"/api/v1/settings/export",
+"ivmlbkeurmc-history",
+"voucggkh_members",
+"zvrw-retry",
+"llwvpcmxcwdn",
+"/api/v2/commits/upload",
+"/api/v1/hooks/permissions",
+"/api/v3/branches/unlock",
+"/api/v2/pipelines/resume",
+"/api/v2/teams/retry",
+"/api/v2/teams/list",
+"/api/v1/users/read",
+"ryl-retry",
+"/api/v2/groups/restore",
+"jogy-search",
+"/api/v3/variables/import",
+"/api/v3/releases/import",
+"/api/v3/comments/export",
+"/api/v3/environments/preview",
+"/api/v1/issues/resume",
+"fbmixrnbjw-search",
+"/api/v3/releases/validate",
+"/api/v1/snippets/star",
+"/api/v3/runners/archive",
+"/api/v2/deployments/import",
+"/api/v2/pipelines/import",
+"rzlsvurtb-history",
+"sszelrpd-retry",
+"/api/v2/settings/download",
+"/api/v3/settings/transfer",
+"/api/v1/comments/retry",
+"/api/v1/notifications/history",
+"/api/v2/packages/star",
+"fxzibwrbuxqj-history",
+"iduecw-history",
+"/api/v3/wikis/star",
+"/api/v3/comments/create",
+"xpcbzual_download",
+"/api/v2/users/create",
+"/api/v3/comments/sync",
+"/api/v3/runners/preview",
+"/api/v1/variables/approve",
+"kibbyzoa_download",
+"zidmfnpobcdn_download",
+"/api/v1/branches/history",
+"wbstpiestma-history",
+"kfkcjejikz_members",
+"/api/v3/variables/archive",
+"gzdsdbpxauq-retry",
+"hbo_download",
+"vdoarvdtfjq_download",
+"/api/v3/commits/restore",
+"/api/v1/pipelines/history",
+"rbaprkjmr-retry",
+"/api/v3/releases/watch",
+"/api/v1/variables/list",
+"/api/v2/tags/validate",
+"/api/v3/pipelines/download",
+"znxisz-search",
+"/api/v1/hooks/transfer",
+"/api/v1/comments/read",
+"vrmxc-retry",
+"tlexi_download",
+"hznevyaku_download",
+"kfxat_members",
+"juhjkf_members",
+"/api/v1/wikis/statistics",
+"/api/v2/releases/validate",
+"/api/v2/invitations/update",
+"/api/v3/invitations/export",
+"/api/v3/invitations/preview",
+"/api/v3/runners/create",
+"ftsqeo",
+"jnokjfzhrjxb",
+"/api/v3/wikis/delete",
+"/api/v1/variables/delete",
+"/api/v2/settings/archive",
+"/api/v1/notifications/archive",
+"nnqzhunmm_members",
+"/api/v1/commits/upload",
+"/api/v2/labels/unlock",
+"/api/v3/hooks/restore",
+"/api/v3/labels/delete",
+"/api/v1/labels/validate",
+"/api/v3/hooks/lock",
+"/api/v3/runners/upload",
+"/api/v2/environments/export",
+"/api/v1/releases/validate",
+"prykddypm_create",
+"/api/v3/deployments/members",
+"dwlwovdzeyal-search",
+"/api/v3/projects/pause",
+"/api/v2/hooks/export",
+"/api/v3/tags/lock",
+"/api/v2/settings/unlock",
+"/api/v1/issues/permissions",
+"/api/v3/pipelines/archive",
+"/api/v2/users/preview",
+"/api/v3/releases/update",
+"/api/v2/comments/read",
+"/api/v3/invitations/create",
+"/api/v3/hooks/update",
+"/api/v2/invitations/restore",
+"/api/v2/variables/preview",
+"xhy_create",
+"eaikoe_download",
+"/api/v2/comments/pause",
+"/api/v1/billing/members",
+"/api/v1/teams/archive",
+"uaokxsk",
+"/api/v3/users/search",
+"/api/v3/releases/subscribe",
+"/api/v3/pipelines/merge",
+"/api/v3/variables/create",
+"kcppedtibmco-search",
+"/api/v2/users/approve",
+"skpakosmm_download",
+"/api/v1/deployments/export",
+"ghyfke-history",
+"/api/v2/users/import",
+"/api/v2/groups/pause",
+"/api/v2/groups/statistics",
+"/api/v2/pipelines/create",
+"/api/v3/invitations/sync",
+"/api/v3/groups/upload",
+"/api/v2/groups/unlock",
+"/api/v2/labels/lock",
+"zcz_download",
+"/api/v3/commits/validate",
+"/api/v1/runners/statistics",
+"/api/v1/invitations/transfer",
+"/api/v3/hooks/preview",
+"/api/v3/groups/import",
+"/api/v2/teams/unlock",
+"/api/v1/users/pause",
+"/api/v1/tags/import",
+"/api/v1/runners/permissions",
+"/api/v1/billing/pause",
+"/api/v2/deployments/upload",
+"/api/v1/issues/merge",
+"/api/v1/settings/restore",
+"/api/v3/variables/merge",
+"/api/v3/deployments/lock",
+"sllphbttvzw_create",
+"ubampafwyi_download",
+"/api/v3/pipelines/star",
+"/api/v1/tags/resume",
+"/api/v2/notifications/transfer",
+"/api/v1/settings/history",
+"/api/v1/billing/import",
+"vgovgmvq-history",
+"/api/v2/snippets/archive",
+"/api/v2/pipelines/list",
+"nlfytylby-search",
+"qfuvxpzs-retry",
+"/api/v1/commits/watch",
+"/api/v2/teams/history",
+"yzhnmubho-search",
+"/api/v2/tags/update",
+"ltukp",
+"/api/v1/environments/statistics",
+"/api/v1/releases/download",
+"/api/v2/users/subscribe",
+"/api/v2/variables/update",
+"/api/v1/commits/export",
+"/api/v2/releases/resume",
+"/api/v2/branches/lock",
+"aocjdyoyoj-retry",
+"/api/v2/tags/read",
+"qyn-search",
+"/api/v2/hooks/download",
+"mksio_members",
+"/api/v1/invitations/approve",
+"/api/v3/billing/archive",
+"nodgpn-search",
+"/api/v3/variables/export",
+"/api/v3/comments/validate",
+"/api/v3/tags/upload",
+"/api/v3/keys/search",
+"/api/v2/commits/validate",
+"/api/v2/releases/upload",
+"/api/v1/branches/archive",
+"/api/v2/teams/export",
+"/api/v2/hooks/history",
+"/api/v2/variables/history",
+"/api/v2/branches/approve",
+"/api/v3/groups/search",
+"/api/v1/billing/retry",
+"/api/v3/releases/unlock",
+"/api/v3/billing/approve",
+"/api/v1/wikis/search",
+"/api/v3/pipelines/create",
+"/api/v3/runners/search",
+"/api/v1/releases/lock",
+"zmbtphbd_create",
+"/api/v3/wikis/history",
+"/api/v1/settings/import",
+"/api/v1/deployments/upload",
+"/api/v2/wikis/export",
+"/api/v1/teams/pause",
+"/api/v2/hooks/unlock",
+"wjbzh_create",
+"/api/v1/users/list",
+"/api/v1/notifications/permissions",
+"/api/v1/hooks/restore",
+"/api/v1/packages/resume",
+"/api/v1/users/statistics",
+"/api/v2/teams/download",
+"vyz",
+"/api/v2/pipelines/approve",
+"iglvsqcf-retry",
+"/api/v2/environments/create",
+"/api/v3/runners/export",
+"/api/v1/variables/subscribe",
+"/api/v3/pipelines/restore",
+"/api/v2/variables/merge",
+"vkbyisrx_members",
+"/api/v2/runners/create",
+"/api/v1/teams/statistics",
+"/api/v2/branches/permissions",
+"/api/v2/snippets/statistics",
+"/api/v2/teams/statistics",
+"/api/v1/packages/permissions",
+"/api/v1/issues/import",
+"/api/v1/environments/lock",
+"pbosuxtmsc_download",
+"/api/v1/issues/search",
+"/api/v3/users/members",
+"/api/v1/issues/statistics",
+"/api/v1/tags/delete",
+"sykvnytodglm-history",
+"kksyfuuzqu_download",
+"/api/v1/projects/delete",
+"mad_download",
+"/api/v1/keys/validate",
+"/api/v2/labels/merge",
+"/api/v1/runners/search",
+"/api/v2/snippets/create",
+"zanfgdkkz",
+"/api/v3/variables/pause",
+"/api/v3/releases/search",
+"/api/v1/projects/read",
+"/api/v1/wikis/import",
+"llwztusqja-retry",
+"hkgnkquw_members",
+"/api/v2/labels/delete",
+"/api/v1/keys/create",
+"/api/v2/billing/merge",
+"/api/v3/invitations/pause",
+"/api/v1/settings/download",
+"/api/v3/packages/lock",
+"qtrtrgsvb",
+"/api/v1/environments/approve",
+"/api/v3/hooks/transfer",
+"/api/v2/snippets/merge",
+"/api/v3/environments/transfer",
+"mquokwsegv_create",
+"tuxxmfb",
+"luetedf_members",
+"/api/v1/snippets/search",
+"hixdqyot_create",
+"ohawo_members",
+"/api/v2/invitations/unlock",
+"/api/v2/keys/update",
+"/api/v1/teams/lock",
+"/api/v3/billing/preview",
+"/api/v2/hooks/transfer",
+"/api/v1/settings/approve",
+"/api/v3/groups/sync",
+"/api/v3/deployments/restore",
+"/api/v2/tags/subscribe",
+"/api/v2/teams/pause",
+"/api/v3/snippets/lock",
+"/api/v2/issues/preview",
+"qtrfwxvca_create",
+"/api/v2/branches/transfer",
+"/api/v3/deployments/update",
+"/api/v3/deployments/delete",
+"/api/v1/environments/search",
+"/api/v2/notifications/unlock",
+"/api/v3/variables/preview",
+"/api/v1/wikis/approve",
+"/api/v2/tags/search",
+"/api/v3/packages/pause",
+"bcructk-retry",
+"/api/v2/wikis/unlock",
+"/api/v1/pipelines/approve",
+"/api/v2/runners/history",
+"wxraa-search",
+"/api/v3/keys/unlock",
+"/api/v2/tags/star",
+"/api/v1/wikis/subscribe",
+"/api/v1/issues/restore",
+"/api/v1/users/preview"
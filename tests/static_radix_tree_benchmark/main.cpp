@@ -0,0 +1,112 @@
+#include <algorithm>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+//
+#include <lyrahgames/xstd/chrono.hpp>
+#include <lyrahgames/xstd/static_radix_tree.hpp>
+
+using namespace std;
+using namespace lyrahgames;
+using namespace xstd;
+
+namespace {
+
+namespace srt = static_radix_tree;
+
+// The keys are a mixture of URL paths and command-like words
+// to resemble the keyword sets of routers and parsers.
+// The same list is used to construct the tree and to generate queries.
+using tree = srt::construction<
+#include "keys.hpp"
+    >;
+const string_view keys[] = {
+#include "keys.hpp"
+};
+
+// Half of the queries are keys.
+// The other half are keys with a modified or missing last character
+// such that mismatches are only detected late.
+auto generate_queries(size_t count) {
+  mt19937 rng{random_device{}()};
+  uniform_int_distribution<size_t> index{0, size(keys) - 1};
+  vector<string> queries(count);
+  for (auto& query : queries) {
+    query = keys[index(rng)];
+    if (rng() & 1) continue;
+    if (rng() & 1)
+      query.back() ^= 1;
+    else
+      query.pop_back();
+  }
+  return queries;
+}
+
+// Print the median time per lookup together with the amount of hits
+// such that all variants can be cross-checked.
+void print(string_view name, const auto& result, size_t count, size_t hits) {
+  const auto time = result.median() / count;
+  cout << setw(30) << name << " = " << setw(10)
+       << chrono::duration<float64, nano>(time).count() << " ns/lookup"
+       << setw(12) << hits << " hits\n";
+}
+
+void benchmark_lookups(const vector<string>& queries) {
+  const auto run = [&](string_view name, auto&& lookup) {
+    size_t hits = 0;
+    const auto result = benchmark([&] {
+      hits = 0;
+      for (const auto& query : queries)
+        hits += lookup(query);
+      return hits;
+    });
+    print(name, result, queries.size(), hits);
+  };
+
+  run("visit (czstring)", [](const string& query) {
+    return srt::visit<tree>(query.c_str(), []<static_zstring> {});
+  });
+  run("visit (string_view)", [](string_view query) {
+    return srt::visit<tree>(query, []<static_zstring> {});
+  });
+  run("hash_visit", [](string_view query) {
+    return srt::hash_visit<tree>(query, []<static_zstring> {});
+  });
+  run("flattening.find", [](string_view query) {
+    return srt::flattening<tree>.find(query) != srt::flattening<tree>.npos;
+  });
+
+  unordered_map<string_view, size_t> map{};
+  for (size_t i = 0; i < size(keys); ++i)
+    map.emplace(keys[i], i);
+  run("unordered_map.find", [&](string_view query) {
+    return map.find(query) != map.end();
+  });
+
+  // The batch lookup resolves all queries at once.
+  const vector<string_view> views(queries.begin(), queries.end());
+  vector<size_t> indices(views.size());
+  size_t hits = 0;
+  const auto result = benchmark([&] {
+    srt::visit_all<tree>(views, indices);
+    hits = ranges::count_if(
+        indices, [](size_t i) { return i != srt::flattening<tree>.npos; });
+    return hits;
+  });
+  print("visit_all", result, queries.size(), hits);
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  const size_t query_count = (argc > 1) ? stoul(argv[1]) : 10'000;
+
+  constexpr auto& flat = srt::flattening<tree>;
+  cout << "keys = " << size(keys) << ", nodes = " << flat.nodes.size()
+       << ", flat tree size = " << sizeof(flat) << " bytes\n";
+  benchmark_lookups(generate_queries(query_count));
+}
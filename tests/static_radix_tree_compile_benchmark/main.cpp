@@ -0,0 +1,225 @@
+#include <elf.h>
+#include <spawn.h>
+#include <sys/resource.h>
+#include <sys/wait.h>
+//
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <set>
+#include <string>
+#include <string_view>
+#include <vector>
+//
+#include <lyrahgames/xstd/utility.hpp>
+
+extern char** environ;
+
+using namespace std;
+using namespace lyrahgames;
+using namespace xstd;
+
+namespace {
+
+// The compile-time benchmark generates translation units
+// which construct static radix trees of the given amount of keys
+// and measures the wall time and peak memory of the compiler for them.
+// The compiler is given by the environment variable 'CXX'.
+// Headers are taken from the source tree this file belongs to.
+const auto source_root =
+    filesystem::absolute(__FILE__).parent_path().parent_path().parent_path();
+
+// The insertion of keys one after another needs minutes
+// and gigabytes of memory for a few hundred keys.
+// So, it is only measured for small key sets by default.
+constexpr size_t max_insertion_keys = 200;
+
+// Generate unique routes like '/api/v2/projects/issues'
+// which share long prefixes as in typical routing tables.
+auto generate_keys(size_t count) {
+  static constexpr string_view segments[] = {
+      "api",     "v1",      "v2",      "users",    "groups", "projects",
+      "issues",  "labels",  "commits", "branches", "list",   "create",
+      "read",    "update",  "delete",  "search",   "export", "history",
+      "members", "hooks",   "jobs",    "tags",     "assets", "keys"};
+  mt19937 rng{count};
+  uniform_int_distribution<size_t> segment{0, size(segments) - 1};
+  uniform_int_distribution<size_t> depth{1, 5};
+  set<string> keys{};
+  while (keys.size() < count) {
+    string key{};
+    for (auto n = depth(rng); n > 0; --n)
+      (key += '/') += segments[segment(rng)];
+    keys.insert(move(key));
+  }
+  return vector<string>(keys.begin(), keys.end());
+}
+
+// Besides the construction of the tree type,
+// the hash visit additionally generates the perfect hash table
+// and the static strings of all leaves.
+// The lookups by 'visit' and by the flat tree are compiled to objects
+// to compare the size of their code and read-only data.
+enum class variant { sorted, insertion, hash_visit, visit, flat_tree };
+
+void write_source(const filesystem::path& path,
+                  const vector<string>& keys,
+                  variant v) {
+  const auto insertion = (v == variant::insertion);
+  ofstream file{path};
+  file << "#include <lyrahgames/xstd/static_radix_tree.hpp>\n"
+       << "namespace srt = lyrahgames::xstd::static_radix_tree;\n"
+       << "using tree = "
+       << (insertion ? "srt::insertion<srt::node<\"\">" : "srt::construction<");
+  for (size_t i = 0; i < keys.size(); ++i)
+    file << ((i || insertion) ? ",\n" : "\n") << '"' << keys[i] << '"';
+  file << ">;\nstatic_assert(sizeof(tree) > 0);\n";
+  if (v == variant::hash_visit)
+    file << "bool lookup(std::string_view str, size_t& size) {\n"
+         << "  return srt::hash_visit<tree>(str,\n"
+         << "      [&]<lyrahgames::xstd::static_zstring key> {\n"
+         << "        size = key.size();\n"
+         << "      });\n"
+         << "}\n";
+  if (v == variant::visit)
+    file << "bool lookup(std::string_view str) {\n"
+         << "  return srt::visit<tree>(str,\n"
+         << "      []<lyrahgames::xstd::static_zstring> {});\n"
+         << "}\n";
+  if (v == variant::flat_tree)
+    file << "bool lookup(std::string_view str) {\n"
+         << "  return srt::flattening<tree>.find(str) != srt::npos;\n"
+         << "}\n";
+}
+
+struct measurement {
+  bool success;
+  chrono::duration<float64> time;
+  // Peak resident memory in KiB.
+  long memory;
+};
+
+// Sizes in bytes of all code and read-only data sections of an object file.
+// Template instantiations are put into their own sections
+// whose names start with the name of the usual section.
+struct section_sizes {
+  size_t text = 0;
+  size_t rodata = 0;
+};
+
+auto object_sizes(const filesystem::path& path) -> section_sizes {
+  ifstream file{path, ios::binary};
+  const auto read = [&](size_t offset, auto& value) {
+    file.seekg(offset);
+    file.read(reinterpret_cast<char*>(&value), sizeof(value));
+  };
+  Elf64_Ehdr header{};
+  read(0, header);
+  if (!file || memcmp(header.e_ident, ELFMAG, SELFMAG) ||
+      header.e_ident[EI_CLASS] != ELFCLASS64)
+    return {};
+  vector<Elf64_Shdr> sections(header.e_shnum);
+  for (size_t i = 0; i < sections.size(); ++i)
+    read(header.e_shoff + i * header.e_shentsize, sections[i]);
+  const auto& names = sections[header.e_shstrndx];
+  section_sizes result{};
+  for (const auto& section : sections) {
+    char name[32]{};
+    file.seekg(names.sh_offset + section.sh_name);
+    file.read(name, sizeof(name) - 1);
+    file.clear();
+    const string_view view{name};
+    if (view.starts_with(".text")) result.text += section.sh_size;
+    if (view.starts_with(".rodata")) result.rodata += section.sh_size;
+  }
+  return result;
+}
+
+// 'wait4' reports the peak memory of the child
+// including all of its waited-for descendants, like the compiler proper.
+// If an object file is given, the source is compiled with optimizations.
+// Otherwise, only its syntax is checked.
+auto compile(const filesystem::path& source,
+             const filesystem::path& object = {}) -> measurement {
+  const auto compiler = getenv("CXX") ? getenv("CXX") : "c++";
+  const auto include = "-I" + source_root.string();
+  vector<string> args{compiler, "-std=c++2b", include, source.string()};
+  if (object.empty())
+    args.push_back("-fsyntax-only");
+  else
+    args.insert(args.end(), {"-O2", "-c", "-o", object.string()});
+  vector<char*> argv{};
+  for (auto& arg : args)
+    argv.push_back(arg.data());
+  argv.push_back(nullptr);
+
+  const auto start = chrono::steady_clock::now();
+  pid_t pid;
+  if (posix_spawnp(&pid, compiler, nullptr, nullptr, argv.data(), environ))
+    return {false, {}, 0};
+  int status = 0;
+  rusage usage{};
+  wait4(pid, &status, 0, &usage);
+  const auto stop = chrono::steady_clock::now();
+  return {WIFEXITED(status) && WEXITSTATUS(status) == 0, stop - start,
+          usage.ru_maxrss};
+}
+
+void print(string_view name,
+           size_t keys,
+           const measurement& m,
+           const section_sizes* sizes = nullptr) {
+  cout << setw(14) << name << setw(8) << keys;
+  if (!m.success) {
+    cout << setw(16) << "failed\n";
+    return;
+  }
+  cout << setw(12) << fixed << setprecision(2) << m.time.count() << " s"
+       << setw(12) << m.memory / 1024 << " MiB";
+  if (sizes)
+    cout << setw(12) << sizes->text << " B" << setw(12) << sizes->rodata
+         << " B";
+  cout << '\n';
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  vector<size_t> counts{};
+  for (int i = 1; i < argc; ++i)
+    counts.push_back(stoul(argv[i]));
+  if (counts.empty()) counts = {100, 500, 2000};
+
+  const auto directory = filesystem::temp_directory_path() /
+                         "static_radix_tree_compile_benchmark";
+  filesystem::create_directories(directory);
+
+  cout << setw(14) << "construction" << setw(8) << "keys" << setw(14)
+       << "time" << setw(16) << "memory" << setw(14) << ".text" << setw(14)
+       << ".rodata\n";
+  for (auto count : counts) {
+    const auto keys = generate_keys(count);
+    const auto source = directory / ("keys_" + to_string(count) + ".cpp");
+    write_source(source, keys, variant::sorted);
+    print("sorted", count, compile(source));
+    write_source(source, keys, variant::hash_visit);
+    print("hash_visit", count, compile(source));
+    const auto object = directory / ("keys_" + to_string(count) + ".o");
+    for (auto [name, v] : {pair{"visit", variant::visit},
+                           pair{"flat_tree", variant::flat_tree}}) {
+      write_source(source, keys, v);
+      const auto m = compile(source, object);
+      const auto sizes = m.success ? object_sizes(object) : section_sizes{};
+      print(name, count, m, &sizes);
+    }
+    if (count > max_insertion_keys) continue;
+    write_source(source, keys, variant::insertion);
+    print("insertion", count, compile(source));
+  }
+  filesystem::remove_all(directory);
+}
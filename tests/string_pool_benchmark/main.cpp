@@ -0,0 +1,136 @@
+#include <algorithm>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+//
+#include <lyrahgames/xstd/chrono.hpp>
+#include <lyrahgames/xstd/string_pool.hpp>
+
+using namespace std;
+using namespace lyrahgames;
+using namespace xstd;
+
+namespace {
+
+// The static strings resemble the keywords of a programming language.
+using pool_type = string_pool<"if", "else", "for", "while", "do", "return",
+                              "break", "continue", "switch", "case",
+                              "default", "struct", "class", "template",
+                              "typename", "auto", "const", "static">;
+
+constexpr string_view keywords[] = {
+    "if",    "else",     "for",      "while", "do",      "return",
+    "break", "continue", "switch",   "case",  "default", "struct",
+    "class", "template", "typename", "auto",  "const",   "static"};
+
+// Identifier-like words of varying length.
+auto generate_words(size_t count) {
+  mt19937 rng{random_device{}()};
+  uniform_int_distribution<size_t> size{3, 16};
+  uniform_int_distribution<int> letter{'a', 'z'};
+  vector<string> words(count);
+  for (auto& word : words) {
+    word.resize(size(rng));
+    for (auto& c : word)
+      c = letter(rng);
+  }
+  return words;
+}
+
+// Every thread interns its own sequence of words.
+// About a tenth of all tokens are keywords.
+auto generate_tokens(const vector<string>& words, size_t count) {
+  mt19937 rng{random_device{}()};
+  uniform_int_distribution<size_t> word{0, words.size() - 1};
+  uniform_int_distribution<size_t> keyword{0, size(keywords) - 1};
+  vector<string_view> tokens(count);
+  for (auto& token : tokens)
+    token = (rng() % 10 == 0) ? keywords[keyword(rng)] : words[word(rng)];
+  return tokens;
+}
+
+// Run the function for every thread and its tokens in parallel
+// and return the throughput in million operations per second.
+auto run(const vector<vector<string_view>>& tokens, size_t threads, auto&& f) {
+  const auto time = duration([&] {
+    vector<jthread> workers{};
+    for (size_t t = 0; t < threads; ++t)
+      workers.emplace_back([&, t] { f(tokens[t]); });
+  });
+  return threads * tokens[0].size() / time.count() / 1e6;
+}
+
+// The baseline is a single hash map that is guarded by one lock
+// and uses the same protocol of shared lookups and unique insertions.
+struct locked_map {
+  auto intern(string_view str) -> uint32 {
+    {
+      shared_lock lock{mutex};
+      const auto it = map.find(str);
+      if (it != map.end()) return it->second;
+    }
+    unique_lock lock{mutex};
+    const auto it = map.find(str);
+    if (it != map.end()) return it->second;
+    auto& s = strings.emplace_back(make_unique<string>(str));
+    const auto id = static_cast<uint32>(map.size());
+    map.emplace(*s, id);
+    return id;
+  }
+
+  shared_mutex mutex{};
+  unordered_map<string_view, uint32> map{};
+  vector<unique_ptr<string>> strings{};
+};
+
+void print(string_view name, float64 mops) {
+  cout << setw(20) << name << " = " << setw(10) << mops << " Mops/s\n";
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  const size_t max_threads =
+      (argc > 1) ? stoul(argv[1]) : max(1u, thread::hardware_concurrency());
+  const size_t operations = (argc > 2) ? stoul(argv[2]) : 1'000'000;
+  const size_t word_count = (argc > 3) ? stoul(argv[3]) : 100'000;
+
+  const auto words = generate_words(word_count);
+  vector<vector<string_view>> tokens(max_threads);
+  for (auto& t : tokens)
+    t = generate_tokens(words, operations);
+
+  cout << "words = " << word_count << ", operations per thread = "
+       << operations << '\n';
+  for (size_t threads = 1; threads <= max_threads; threads *= 2) {
+    cout << "threads = " << threads << '\n';
+
+    pool_type pool{};
+    const auto intern = [&](const auto& list) {
+      uint32 sum = 0;
+      for (auto token : list)
+        sum += pool.intern(token).value;
+      do_not_optimize(sum);
+    };
+    print("pool (cold)", run(tokens, threads, intern));
+    print("pool (warm)", run(tokens, threads, intern));
+
+    locked_map map{};
+    const auto baseline = [&](const auto& list) {
+      uint32 sum = 0;
+      for (auto token : list)
+        sum += map.intern(token);
+      do_not_optimize(sum);
+    };
+    print("locked map (cold)", run(tokens, threads, baseline));
+    print("locked map (warm)", run(tokens, threads, baseline));
+  }
+}